@@ -26,22 +26,48 @@
 #define __BINPROTO_HPP__
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <assert.h>
+#include <stddef.h>
+#include <string.h>
 #include <string>
 #include <vector>
+#include <map>
 
 #if defined(_WIN32) || defined(WIN32)
 
-#include <WinSock2.h>
-#pragma comment(lib,"ws2_32.lib")
+#include <io.h>
+#include <intrin.h>
 //warning C4244: 'argument' : conversion from 'const uint64_t' to 'u_long', possible loss of data
 #pragma warning(disable : 4290)
 //warning C4290: C++ exception specification ignored except to indicate a function is not __declspec(nothrow)
 #pragma warning(disable : 4244)
 
 #else
-#include <arpa/inet.h>
-#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/uio.h>
+#endif
+
+//simd byte swapping of numeric lists, chosen by the target flags of the build (-mssse3, -mavx2, /arch:AVX2),
+//define BINPROTO_DISABLE_SIMD to use the scalar loop only.
+#if !defined(BINPROTO_DISABLE_SIMD) && defined(__AVX2__)
+#	include <immintrin.h>
+#	define _BINPROTO_SIMD_AVX2
+#	define _BINPROTO_SIMD_SSSE3
+#elif !defined(BINPROTO_DISABLE_SIMD) && defined(__SSSE3__)
+#	include <tmmintrin.h>
+#	define _BINPROTO_SIMD_SSSE3
+#endif
+
+//thread_pool of batch serialization needs c++11 threads,
+//define BINPROTO_DISABLE_THREADS to leave it out, a batch then runs on inline_pool or on a pool of your own.
+#if !defined(BINPROTO_DISABLE_THREADS) && (__cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L))
+#	include <thread>
+#	include <mutex>
+#	include <condition_variable>
+#	include <atomic>
+#	define _BINPROTO_THREADS
 #endif
 
 //comma macro
@@ -114,6 +140,105 @@ struct _binproto_is_binproto_obj
 	enum{value = sizeof(deduce<T>(0)) == sizeof(char)};
 };
 
+//judge a class has a lazy view type by SFINAE
+template<typename T>
+struct _binproto_has_view
+{
+	template <typename U> static char deduce(typename U::view*);
+	template <typename U> static int deduce(...);
+	enum{value = sizeof(deduce<T>(0)) == sizeof(char)};
+};
+
+//the type a lazy view returns for a field of type T,
+//types without a view are decoded eagerly
+template<typename T, int has_view = _binproto_has_view<T>::value>
+struct _binproto_view_traits
+{
+	typedef T type;
+	static type make(const char* buffer,uint32_t bufflen)
+	{
+		type obj;
+		obj.parse_from_buffer(buffer,bufflen);
+		return obj;
+	}
+};
+template<typename T>
+struct _binproto_view_traits<T,1>
+{
+	typedef typename T::view type;
+	static type make(const char* buffer,uint32_t bufflen)
+	{
+		return type(buffer,bufflen);
+	}
+};
+
+//byte order of the host, detected at compile time
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+#	if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#		define _BINPROTO_BIG_ENDIAN_HOST
+#	endif
+#elif defined(__BIG_ENDIAN__) || defined(__ARMEB__) || defined(__MIPSEB__) || defined(__sparc) || defined(__sparc__)
+#	define _BINPROTO_BIG_ENDIAN_HOST
+#endif
+
+//native byte swap
+inline uint16_t _binproto_bswap16(uint16_t num)
+{
+#if defined(_MSC_VER)
+	return _byteswap_ushort(num);
+#elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8)))
+	return __builtin_bswap16(num);
+#else
+	return (uint16_t)((num << 8) | (num >> 8));
+#endif
+}
+inline uint32_t _binproto_bswap32(uint32_t num)
+{
+#if defined(_MSC_VER)
+	return _byteswap_ulong(num);
+#elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3)))
+	return __builtin_bswap32(num);
+#else
+	return (num << 24) | ((num << 8) & 0x00FF0000) | ((num >> 8) & 0x0000FF00) | (num >> 24);
+#endif
+}
+inline uint64_t _binproto_bswap64(uint64_t num)
+{
+#if defined(_MSC_VER)
+	return _byteswap_uint64(num);
+#elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3)))
+	return __builtin_bswap64(num);
+#else
+	return ((uint64_t)_binproto_bswap32((uint32_t)num) << 32) | _binproto_bswap32((uint32_t)(num >> 32));
+#endif
+}
+
+//byte swap overloaded on the number type
+inline uint8_t _binproto_bswap(uint8_t num){return num;}
+inline uint16_t _binproto_bswap(uint16_t num){return _binproto_bswap16(num);}
+inline uint32_t _binproto_bswap(uint32_t num){return _binproto_bswap32(num);}
+inline uint64_t _binproto_bswap(uint64_t num){return _binproto_bswap64(num);}
+
+//index of the lowest set bit, num must not be 0
+inline uint32_t _binproto_ctz64(uint64_t num)
+{
+#if defined(__clang__) || defined(__GNUC__)
+	return __builtin_ctzll(num);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index,num);
+	return index;
+#else
+	uint32_t n = 0;
+	while(!(num & 1))
+	{
+		num >>= 1;
+		++n;
+	}
+	return n;
+#endif
+}
+
 //max value traits
 #if defined(linux) && !defined(__STDC_LIMIT_MACROS)
 # error "you should predefine __STDC_LIMIT_MACROS on linux"
@@ -126,24 +251,71 @@ struct _binproto_num_type_traits
 		((BINPROTO_IS_SAME_TYPE(num_type,uint8_t))||
 		(BINPROTO_IS_SAME_TYPE(num_type,uint16_t))||
 		(BINPROTO_IS_SAME_TYPE(num_type,uint32_t))||
-		(BINPROTO_IS_SAME_TYPE(num_type,uint64_t))),
-		"typename must be uint8_t or uint16_t or uint32_t or uint64_t");
+		(BINPROTO_IS_SAME_TYPE(num_type,uint64_t))||
+		(BINPROTO_IS_SAME_TYPE(num_type,int8_t))||
+		(BINPROTO_IS_SAME_TYPE(num_type,int16_t))||
+		(BINPROTO_IS_SAME_TYPE(num_type,int32_t))||
+		(BINPROTO_IS_SAME_TYPE(num_type,int64_t))||
+		(BINPROTO_IS_SAME_TYPE(num_type,float))||
+		(BINPROTO_IS_SAME_TYPE(num_type,double))),
+		"typename must be uint8_t to uint64_t, int8_t to int64_t, float or double");
 };
 template<> struct _binproto_num_type_traits<uint8_t>{
 	static const uint8_t num_type_max = UINT8_MAX;
 	static const int num_type_size = 1;
+	typedef uint8_t bits_type;
+	static const char* parse_error(){return "uint8_obj parse error";}
 };
 template<> struct _binproto_num_type_traits<uint16_t>{
 	static const uint16_t num_type_max = UINT16_MAX;
 	static const int num_type_size = 2;
+	typedef uint16_t bits_type;
+	static const char* parse_error(){return "uint16_obj parse error";}
 };
 template<> struct _binproto_num_type_traits<uint32_t>{
 	static const uint32_t num_type_max = UINT32_MAX;
 	static const int num_type_size = 4;
+	typedef uint32_t bits_type;
+	static const char* parse_error(){return "uint32_obj parse error";}
 };
 template<> struct _binproto_num_type_traits<uint64_t>{
 	static const uint64_t num_type_max = UINT64_MAX;
 	static const int num_type_size = 8;
+	typedef uint64_t bits_type;
+	static const char* parse_error(){return "uint64_obj parse error";}
+};
+//signed and floating point numbers are swapped as the unsigned number of the same size
+template<> struct _binproto_num_type_traits<int8_t>{
+	static const int num_type_size = 1;
+	typedef uint8_t bits_type;
+	static const char* parse_error(){return "int8_obj parse error";}
+};
+template<> struct _binproto_num_type_traits<int16_t>{
+	static const int num_type_size = 2;
+	typedef uint16_t bits_type;
+	static const char* parse_error(){return "int16_obj parse error";}
+};
+template<> struct _binproto_num_type_traits<int32_t>{
+	static const int num_type_size = 4;
+	typedef uint32_t bits_type;
+	static const char* parse_error(){return "int32_obj parse error";}
+};
+template<> struct _binproto_num_type_traits<int64_t>{
+	static const int num_type_size = 8;
+	typedef uint64_t bits_type;
+	static const char* parse_error(){return "int64_obj parse error";}
+};
+template<> struct _binproto_num_type_traits<float>{
+	BINPROTO_STATIC_ASSERT(sizeof(float) == 4,"float must be 32 bits");
+	static const int num_type_size = 4;
+	typedef uint32_t bits_type;
+	static const char* parse_error(){return "float32_obj parse error";}
+};
+template<> struct _binproto_num_type_traits<double>{
+	BINPROTO_STATIC_ASSERT(sizeof(double) == 8,"double must be 64 bits");
+	static const int num_type_size = 8;
+	typedef uint64_t bits_type;
+	static const char* parse_error(){return "float64_obj parse error";}
 };
 #define BINPROTO_UINT_MAX_VALUE(uint_type) (_binproto_num_type_traits<uint_type>::num_type_max)
 #define BINPROTO_UINT_SIZE(uint_type) (_binproto_num_type_traits<uint_type>::num_type_size)
@@ -166,6 +338,40 @@ template<> struct _binproto_uint_size_traits<8>{
 };
 #define BINPROTO_UINT_TYPE_FROM_SIZE(size) typename _binproto_uint_size_traits<size>::uint_type
 
+//thread local storage;
+#if __cplusplus >= 201103L
+#	define _BINPROTO_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#	define _BINPROTO_THREAD_LOCAL __declspec(thread)
+#else
+#	define _BINPROTO_THREAD_LOCAL __thread
+#endif
+
+//intended fall through between the cases of a switch
+#if __cplusplus >= 201703L
+#	define _BINPROTO_FALLTHROUGH [[fallthrough]]
+#elif defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 7
+#	define _BINPROTO_FALLTHROUGH __attribute__((fallthrough))
+#else
+#	define _BINPROTO_FALLTHROUGH
+#endif
+
+//default allocator of variable_len_string and binary_obj_list,
+//define BINPROTO_USE_ARENA_ALLOCATOR the same way in every translation unit to allocate from binproto::arena_scope.
+#ifdef BINPROTO_USE_ARENA_ALLOCATOR
+#	define BINPROTO_DEFAULT_ALLOCATOR(type) binproto::arena_allocator<type>
+#else
+#	define BINPROTO_DEFAULT_ALLOCATOR(type) std::allocator<type>
+#endif
+
+//default wire byte order of num_obj and of all length prefixes,
+//define BINPROTO_WIRE_LITTLE_ENDIAN the same way in every translation unit, and on both ends of a connection.
+#ifdef BINPROTO_WIRE_LITTLE_ENDIAN
+#	define BINPROTO_DEFAULT_BYTE_ORDER binproto::little_endian
+#else
+#	define BINPROTO_DEFAULT_BYTE_ORDER binproto::big_endian
+#endif
+
 //assert;
 #ifdef BINPROTO_DISABLE_ASSERT
 #	define BINPROTO_ASSERT(expr,err_msg) ((void)0)
@@ -173,6 +379,21 @@ template<> struct _binproto_uint_size_traits<8>{
 #	define BINPROTO_ASSERT(expr,err_msg) assert(expr)
 #endif
 
+//exceptions are off when compiling with -fno-exceptions or /EHs-c-,
+//then the throwing api aborts on error and the parse_status api should be used instead.
+#if !defined(BINPROTO_NO_EXCEPTIONS) && !defined(__EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(_CPPUNWIND)
+#	define BINPROTO_NO_EXCEPTIONS
+#endif
+
+//dynamic exception specifications are kept before c++11 only, c++17 removed them
+#if defined(BINPROTO_NO_EXCEPTIONS) || __cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L)
+#	define BINPROTO_THROW_SPEC
+#else
+#	define BINPROTO_THROW_SPEC throw(binproto::exception)
+#endif
+
+#ifndef BINPROTO_NO_EXCEPTIONS
+
 //throw exception;
 #define BINPROTO_THROW(err_msg) throw(binproto::exception(err_msg))
 
@@ -184,27 +405,63 @@ template<> struct _binproto_uint_size_traits<8>{
 #define _BINPROTO_PARSE_CATCH(levelname) \
 	}catch(const binproto::exception& ex){ex.throw_to_high_level(levelname);return 0;}
 
-//new serialize and parse on std::string function defination
+#else
+
+#define BINPROTO_THROW(err_msg) abort()
+#define _BINPROTO_PARSE_ENSURE(expr,err_msg) \
+	if(!(expr)){abort();}
+#define _BINPROTO_PARSE_TRY \
+	{
+#define _BINPROTO_PARSE_CATCH(levelname) \
+	}
+
+#endif
+
+//new serialize and parse on std::string function defination,
+//serialize_to_buffer replaces the content of the container, append_to_buffer serializes after it,
+//both write straight into the container storage.
 #define BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 uint32_t serialize_to_buffer(std::vector<char>& vecbuff) const \
 { \
-	vecbuff.resize(get_binary_len()); \
-	return serialize_to_buffer(&vecbuff[0],vecbuff.size()); \
+	vecbuff.clear(); \
+	return append_to_buffer(vecbuff); \
+} \
+uint32_t append_to_buffer(std::vector<char>& vecbuff) const \
+{ \
+	size_t old_size = vecbuff.size(); \
+	uint32_t binary_len = get_binary_len(); \
+	if(binary_len == 0){return 0;} \
+	vecbuff.resize(old_size + binary_len); \
+	return serialize_to_buffer(&vecbuff[old_size],binary_len); \
 } \
-uint32_t parse_from_buffer(const std::vector<char>& vecbuff) throw(binproto::exception) \
+uint32_t parse_from_buffer(const std::vector<char>& vecbuff) BINPROTO_THROW_SPEC \
 { \
-	return parse_from_buffer(&vecbuff[0],vecbuff.size()); \
+	return parse_from_buffer(vecbuff.empty() ? NULL : &vecbuff[0],vecbuff.size()); \
 } \
 uint32_t serialize_to_buffer(std::string& strbuff) const \
 { \
-	std::vector<char> vecbuff(get_binary_len()); \
-	serialize_to_buffer(&vecbuff[0],vecbuff.size()); \
-	strbuff.assign(&vecbuff[0],vecbuff.size()); \
-	return vecbuff.size(); \
+	strbuff.clear(); \
+	return append_to_buffer(strbuff); \
+} \
+uint32_t append_to_buffer(std::string& strbuff) const \
+{ \
+	size_t old_size = strbuff.size(); \
+	uint32_t binary_len = get_binary_len(); \
+	if(binary_len == 0){return 0;} \
+	strbuff.resize(old_size + binary_len); \
+	return serialize_to_buffer(&strbuff[old_size],binary_len); \
 } \
-uint32_t parse_from_buffer(const std::string& strbuff) throw(binproto::exception) \
+uint32_t parse_from_buffer(const std::string& strbuff) BINPROTO_THROW_SPEC \
 { \
 	return parse_from_buffer(strbuff.c_str(),strbuff.size()); \
+} \
+uint32_t parse_from_buffer(const std::vector<char>& vecbuff,binproto::parse_status& status) \
+{ \
+	return parse_from_buffer(vecbuff.empty() ? NULL : &vecbuff[0],vecbuff.size(),status); \
+} \
+uint32_t parse_from_buffer(const std::string& strbuff,binproto::parse_status& status) \
+{ \
+	return parse_from_buffer(strbuff.c_str(),strbuff.size(),status); \
 }
 
 namespace binproto
@@ -231,571 +488,5136 @@ namespace binproto
 	private:
 		std::string _comment;
 	};
-	
-	template<typename numtype>
-	class num_obj
+
+	//result of the exception-free parse api,
+	//parse_from_buffer(buffer,bufflen,status) resets the status, then returns 0 and fills it on error,
+	//so one status can be reused across parses.
+	//offset is counted from the start of the outermost buffer,
+	//packet and field name the innermost packet field which failed.
+	class parse_status
 	{
 	public:
-		typedef numtype uint_type;
-		static const int STATIC_BINARY_LENGTH = BINPROTO_UINT_SIZE(numtype);
-	public:
-		num_obj()
-			:_num(0)
+		enum error_code
 		{
-		}
-		num_obj(numtype num)
-			:_num(num)
+			ok_code = 0,
+			short_buffer,
+			invalid_data
+		};
+	public:
+		parse_status()
+			:_code(ok_code),_offset(0),_packet(NULL),_field(NULL)
 		{
 		}
-		num_obj(const num_obj& num)
-			:_num(num._num)
+		bool ok() const
 		{
+			return _code == ok_code;
 		}
-		num_obj& operator=(numtype num)
+		error_code code() const
 		{
-			_num = num;
-			return *this;
+			return _code;
 		}
-		num_obj& operator=(const num_obj& num)
+		uint32_t offset() const
 		{
-			_num = num._num;
-			return *this;
+			return _offset;
 		}
-		numtype to_int() const
+		const char* packet() const
 		{
-			return _num;
+			return _packet ? _packet : "";
 		}
-		bool operator<(const num_obj& other) const
+		const char* field() const
 		{
-			return _num < other._num;
+			return _field ? _field : "";
 		}
-		bool operator==(const num_obj& other) const
+		void reset()
 		{
-			return _num == other._num;
+			_code = ok_code;
+			_offset = 0;
+			_packet = NULL;
+			_field = NULL;
 		}
-		bool operator>(const num_obj& other) const
+		uint32_t fail(error_code code)
 		{
-			return _num > other._num;
+			_code = code;
+			_offset = 0;
+			_packet = NULL;
+			_field = NULL;
+			return 0;
 		}
-		bool operator!=(const num_obj& other) const
+		uint32_t fail_at(uint32_t offset)
 		{
-			return _num != other._num;
+			_offset += offset;
+			return 0;
 		}
-		inline uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const ;
-		inline uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) throw(exception);
-		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
-		uint32_t get_binary_len() const
+		uint32_t fail_at(uint32_t offset,const char* packet,const char* field)
 		{
-			return STATIC_BINARY_LENGTH;
+			_offset += offset;
+			if(!_field)
+			{
+				_packet = packet;
+				_field = field;
+			}
+			return 0;
 		}
 	private:
-		numtype _num;
+		error_code _code;
+		uint32_t _offset;
+		const char* _packet;
+		const char* _field;
 	};
 
-	typedef num_obj<uint8_t> uint8_obj;
-	typedef num_obj<uint16_t> uint16_obj;
-	typedef num_obj<uint32_t> uint32_obj;
-	typedef num_obj<uint64_t> uint64_obj;
-
-	template<>
-	inline uint32_t uint8_obj::parse_from_buffer(const char* buffer,uint32_t bufflen) throw(exception)
-	{
-		_BINPROTO_PARSE_ENSURE(bufflen >= STATIC_BINARY_LENGTH,"uint8_obj parse error");
-		_num = buffer[0];
-		return STATIC_BINARY_LENGTH;
-	}
-	template<>
-	inline uint32_t uint8_obj::serialize_to_buffer(char* buffer,uint32_t bufflen) const 
-	{
-		BINPROTO_ASSERT(bufflen >= STATIC_BINARY_LENGTH,"uint8_obj serialize error");
-		buffer[0] = _num;
-		return STATIC_BINARY_LENGTH;
-	}
-	template<>
-	inline uint32_t uint16_obj::parse_from_buffer(const char* buffer,uint32_t bufflen) throw(exception)
-	{
-		_BINPROTO_PARSE_ENSURE(bufflen >= STATIC_BINARY_LENGTH,"uint16_obj parse error");
-		memcpy(&_num,buffer,STATIC_BINARY_LENGTH);
-		_num = ntohs(_num);
-		return STATIC_BINARY_LENGTH;
-	}
-	template<>
-	inline uint32_t uint16_obj::serialize_to_buffer(char* buffer,uint32_t bufflen) const 
+	//resume point of an incremental parse, one frame per nesting level,
+	//parse_some(buffer,bufflen,cursor,depth) consumes what it can from the buffer by advancing buffer and bufflen,
+	//and returns true when the object at depth is complete.
+	//the caller resets the frame of a child when the child completes, so a frame not in progress is always reset.
+	//malformed input fails the cursor and parse_some returns false, failed() tells it from a short chunk,
+	//a failed cursor must be cleared before the next parse.
+	class parse_cursor
 	{
-		BINPROTO_ASSERT(bufflen >= STATIC_BINARY_LENGTH,"uint16_obj serialize error");
-		uint16_t net_uint = htons(_num);
-		memcpy(buffer,&net_uint,STATIC_BINARY_LENGTH);
-		return STATIC_BINARY_LENGTH;
-	}
-	template<>
-	inline uint32_t uint32_obj::parse_from_buffer(const char* buffer,uint32_t bufflen) throw(exception)
-	{
-		_BINPROTO_PARSE_ENSURE(bufflen >= STATIC_BINARY_LENGTH,"uint32_obj parse error");
-		memcpy(&_num,buffer,STATIC_BINARY_LENGTH);
-		_num = ntohl(_num);
-		return STATIC_BINARY_LENGTH;
-	}
-	template<>
-	inline uint32_t uint32_obj::serialize_to_buffer(char* buffer,uint32_t bufflen) const 
-	{
-		BINPROTO_ASSERT(bufflen >= STATIC_BINARY_LENGTH,"uint32_obj serialize error");
-		uint32_t net_uint = htonl(_num);
-		memcpy(buffer,&net_uint,STATIC_BINARY_LENGTH);
-		return STATIC_BINARY_LENGTH;
-	}
-	template<>
-	inline uint32_t uint64_obj::parse_from_buffer(const char* buffer,uint32_t bufflen) throw(exception)
-	{
-		_BINPROTO_PARSE_ENSURE(bufflen >= STATIC_BINARY_LENGTH,"uint64_obj parse error");
-		uint32_t net_uint;
-		memcpy(&net_uint,buffer,BINPROTO_UINT_SIZE(uint32_t));
-		_num = ntohl(net_uint);
-		_num = _num << 32;
-		memcpy(&net_uint,buffer+4,BINPROTO_UINT_SIZE(uint32_t));
-		_num += ntohl(net_uint);
-		return STATIC_BINARY_LENGTH;
-	}
-	template<>
-	inline uint32_t uint64_obj::serialize_to_buffer(char* buffer,uint32_t bufflen) const 
-	{
-		BINPROTO_ASSERT(bufflen >= STATIC_BINARY_LENGTH,"uint64_obj serialize error");
-		uint32_t net_uint = htonl(_num>>32);
-		memcpy(buffer,&net_uint,BINPROTO_UINT_SIZE(uint32_t));
-		net_uint = htonl(_num);
-		memcpy(buffer+4,&net_uint,BINPROTO_UINT_SIZE(uint32_t));
-		return STATIC_BINARY_LENGTH;
-	}
-	
-	template<int len_size>
-	class variable_len_string
-	{
-	public:
-		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(len_size)> len_type;
-		static const int STATIC_BINARY_LENGTH = 0;
 	public:
-		variable_len_string(){}
-		variable_len_string(const char* str)
+		struct frame
 		{
-			BINPROTO_ASSERT(strlen(str) <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
-			_str = str;
-		}
-		variable_len_string(const char* str, uint32_t size)
+			uint32_t step;
+			uint32_t index;
+			uint64_t count;
+			uint32_t partial_len;
+			char partial[8];
+		};
+	public:
+		parse_cursor()
+			:_failed(false)
 		{
-			BINPROTO_ASSERT(size <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
-			_str.assign(str,size);
-		}
-		variable_len_string(const std::string& str):_str(str){
-			BINPROTO_ASSERT(str.size() <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
 		}
-		variable_len_string(const variable_len_string& str):_str(str._str){}
-		variable_len_string& operator=(const std::string& str)
+		frame& at(uint32_t depth)
 		{
-			BINPROTO_ASSERT(str.size() <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
-			_str = str;
-			return *this;
+			if(depth >= _frames.size())
+				_frames.resize(depth + 1,_empty_frame());
+			return _frames[depth];
 		}
-		variable_len_string& operator=(const char* str)
+		void reset(uint32_t depth)
 		{
-			BINPROTO_ASSERT(strlen(str) <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
-			_str = str;
-			return *this;
+			if(depth < _frames.size())
+				_frames[depth] = _empty_frame();
 		}
-		variable_len_string& operator=(const variable_len_string& str)
+		void clear()
 		{
-			_str = str._str;
-			return *this;
+			_frames.clear();
+			_failed = false;
 		}
-		variable_len_string& assign(const char* str, uint32_t size)
+		//returns false for parse_some to return
+		bool fail()
 		{
-			BINPROTO_ASSERT(size <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
-			_str.assign(str,size);
-			return *this;
+			_failed = true;
+			return false;
 		}
-		const std::string& to_string() const
+		bool failed() const
 		{
-			return _str;
+			return _failed;
 		}
-		std::string trim() const
+	private:
+		static frame _empty_frame()
 		{
-			return _str.substr(0,strlen(c_str()));
+			frame f;
+			memset(&f,0,sizeof(f));
+			return f;
 		}
-		const char* c_str() const
+	private:
+		std::vector<frame> _frames;
+		bool _failed;
+	};
+
+	//output sinks for serialize_to_sink, which serializes in one traversal without get_binary_len.
+	//a sink type has:
+	//	char* reserve(uint32_t n)		returns at least n contiguous writable bytes
+	//	void commit(uint32_t n)			n bytes of the reserved area are written
+	//	void write(const char* data,uint32_t n)
+	//strings up to _BINPROTO_SINK_INLINE_LEN are copied through one reserve with their length prefix,
+	//longer ones are handed to write() so the sink can pass them through without staging.
+#define _BINPROTO_SINK_INLINE_LEN 256
+
+	//contiguous buffer which grows as needed, clear() keeps the capacity for the next packet
+	class growable_buffer_sink
+	{
+	public:
+		explicit growable_buffer_sink(uint32_t capacity = 256)
+			:_buffer(capacity ? capacity : 1)
 		{
-			return _str.c_str();
+			_cur = &_buffer[0];
+			_end = _cur + _buffer.size();
 		}
-		uint32_t size() const
+		char* reserve(uint32_t n)
 		{
-			return _str.size();
+			if((uint32_t)(_end - _cur) < n)
+				_grow(n);
+			return _cur;
 		}
-		bool operator<(const variable_len_string& other) const
+		void commit(uint32_t n)
 		{
-			return _str < other._str;
+			BINPROTO_ASSERT(_cur + n <= _end,"growable_buffer_sink commit more than reserved");
+			_cur += n;
 		}
-		bool operator==(const variable_len_string& other) const
+		void write(const char* data,uint32_t n)
 		{
-			return _str == other._str;
+			memcpy(reserve(n),data,n);
+			_cur += n;
 		}
-		bool operator>(const variable_len_string& other) const
+		const char* data() const
 		{
-			return _str > other._str;
+			return &_buffer[0];
 		}
-		bool operator!=(const variable_len_string& other) const
+		uint32_t size() const
 		{
-			return _str != other._str;
+			return _cur - &_buffer[0];
 		}
-		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const 
+		void clear()
 		{
-			BINPROTO_ASSERT(get_binary_len() <= bufflen,"variable_len_string serialize error");
-			uint32_t temp_len = 0;
-			temp_len+=len_type(_str.length()).serialize_to_buffer(buffer,bufflen);
-			memcpy(buffer+temp_len,_str.c_str(),_str.length());
-			temp_len += _str.size();
-			return temp_len;
+			_cur = &_buffer[0];
 		}
-		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) throw(exception)
+		//moves the serialized bytes out, the sink is empty afterwards
+		void swap_buffer(std::vector<char>& vecbuff)
 		{
-			uint32_t temp_len = 0;
-			len_type temp;
-			_BINPROTO_PARSE_ENSURE(bufflen >= temp.get_binary_len(),"variable_len_string parse error");
-			temp_len += temp.parse_from_buffer(buffer,bufflen);
-			_BINPROTO_PARSE_ENSURE(bufflen >= temp_len + temp.to_int(),"variable_len_string parse error");
-			_str.assign(buffer + temp_len,temp.to_int());
-			temp_len += temp.to_int();
-			return temp_len;
+			_buffer.resize(size());
+			_buffer.swap(vecbuff);
+			_buffer.resize(1);
+			_cur = &_buffer[0];
+			_end = _cur + _buffer.size();
 		}
-		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
-		uint32_t get_binary_len() const
+	private:
+		void _grow(uint32_t n)
 		{
-			return len_size	+ _str.length();
+			size_t used = size();
+			size_t capacity = _buffer.size() * 2;
+			_buffer.resize(capacity < used + n ? used + n : capacity);
+			_cur = &_buffer[0] + used;
+			_end = &_buffer[0] + _buffer.size();
 		}
 	private:
-		std::string _str;
+		growable_buffer_sink(const growable_buffer_sink&);
+		growable_buffer_sink& operator=(const growable_buffer_sink&);
+	private:
+		std::vector<char> _buffer;
+		char* _cur;
+		char* _end;
 	};
 
-	template<int str_len>
-	class fixed_len_string
+	//caller's fixed buffer, writes past the end are dropped and overflow() becomes true
+	class fixed_buffer_sink
 	{
 	public:
-		static const int STATIC_BINARY_LENGTH = str_len;
-	public:
-		fixed_len_string()
-		{
-			memset(_str, 0, STATIC_BINARY_LENGTH + 1);
-		}
-		fixed_len_string(const char* str)
+		fixed_buffer_sink(char* buffer,uint32_t bufflen)
+			:_buffer(buffer),_bufflen(bufflen),_size(0),_overflow(false)
 		{
-			_str[STATIC_BINARY_LENGTH] = 0;
-			*this = str;
-		}
-		fixed_len_string(const char* str, uint32_t size)
-		{
-			_str[STATIC_BINARY_LENGTH] = 0;
-			assign(str,size);
 		}
-		fixed_len_string(const std::string& str)
+		char* reserve(uint32_t n)
 		{
-			_str[STATIC_BINARY_LENGTH] = 0;
-			*this = str;
+			if(_fits(n))
+				return _buffer + _size;
+			_overflow = true;
+			if(_scratch.size() < n)
+				_scratch.resize(n);
+			return &_scratch[0];
 		}
-		fixed_len_string(const fixed_len_string& str)
+		void commit(uint32_t n)
 		{
-			_str[STATIC_BINARY_LENGTH] = 0;
-			*this = str;
+			if(_fits(n))
+				_size += n;
 		}
-		fixed_len_string& operator=(const std::string& str)
+		void write(const char* data,uint32_t n)
 		{
-			if(str.size() >= STATIC_BINARY_LENGTH)
+			if(_fits(n))
 			{
-				memcpy(_str,str.c_str(),STATIC_BINARY_LENGTH);
+				memcpy(_buffer + _size,data,n);
+				_size += n;
 			}
 			else
 			{
-				memcpy(_str,str.c_str(),str.size());
-				memset(_str + str.size(),0,STATIC_BINARY_LENGTH - str.size());
+				_overflow = true;
 			}
-			return *this;
 		}
-		fixed_len_string& operator=(const char* str)
+		uint32_t size() const
 		{
-			uint32_t paralen = strlen(str);
-			if(paralen >= STATIC_BINARY_LENGTH)
+			return _size;
+		}
+		bool overflow() const
+		{
+			return _overflow;
+		}
+	private:
+		bool _fits(uint32_t n) const
+		{
+			return !_overflow && _bufflen - _size >= n;
+		}
+	private:
+		char* _buffer;
+		uint32_t _bufflen;
+		uint32_t _size;
+		bool _overflow;
+		std::vector<char> _scratch;
+	};
+
+	//file descriptor sink, small writes are gathered in a buffer which is flushed when full,
+	//writes larger than the buffer go straight to the descriptor.
+	class fd_sink
+	{
+	public:
+		explicit fd_sink(int fd,uint32_t buffer_size = 64 * 1024)
+			:_fd(fd),_buffer(buffer_size),_size(0),_failed(false)
+		{
+		}
+		~fd_sink()
+		{
+			flush();
+		}
+		char* reserve(uint32_t n)
+		{
+			if(_buffer.size() - _size < n)
 			{
-				memcpy(_str,str,STATIC_BINARY_LENGTH);
+				flush();
+				if(_buffer.size() < n)
+					_buffer.resize(n);
+			}
+			return &_buffer[_size];
+		}
+		void commit(uint32_t n)
+		{
+			BINPROTO_ASSERT(_size + n <= _buffer.size(),"fd_sink commit more than reserved");
+			_size += n;
+		}
+		void write(const char* data,uint32_t n)
+		{
+			if(_buffer.size() - _size >= n)
+			{
+				memcpy(&_buffer[_size],data,n);
+				_size += n;
+				return;
+			}
+			flush();
+			if(n < _buffer.size())
+			{
+				memcpy(&_buffer[0],data,n);
+				_size = n;
 			}
 			else
 			{
-				memcpy(_str,str,paralen);
-				memset(_str + paralen,0,STATIC_BINARY_LENGTH - paralen);
+				_write_all(data,n);
 			}
-			return *this;
 		}
-		fixed_len_string& operator=(const fixed_len_string& packstring)
+		//returns false if any write to the descriptor failed
+		bool flush()
 		{
-			memcpy(_str,packstring._str,STATIC_BINARY_LENGTH);
+			if(_size != 0)
+			{
+				_write_all(&_buffer[0],_size);
+				_size = 0;
+			}
+			return !_failed;
+		}
+		bool failed() const
+		{
+			return _failed;
+		}
+	private:
+		void _write_all(const char* data,uint32_t n)
+		{
+			while(n != 0 && !_failed)
+			{
+#if defined(_WIN32) || defined(WIN32)
+				int ret = ::_write(_fd,data,n);
+#else
+				ssize_t ret = ::write(_fd,data,n);
+				if(ret < 0 && errno == EINTR)
+					continue;
+#endif
+				if(ret <= 0)
+				{
+					_failed = true;
+					break;
+				}
+				data += ret;
+				n -= (uint32_t)ret;
+			}
+		}
+	private:
+		fd_sink(const fd_sink&);
+		fd_sink& operator=(const fd_sink&);
+	private:
+		int _fd;
+		std::vector<char> _buffer;
+		uint32_t _size;
+		bool _failed;
+	};
+
+#if !defined(_WIN32) && !defined(WIN32)
+	//scatter/gather sink for writev/sendmsg, headers and small fields are packed into a scratch buffer,
+	//writes of at least ref_threshold bytes become segments which point at the serialized object's own storage,
+	//so the object must stay alive and unchanged until the segments are sent.
+	//strings up to _BINPROTO_SINK_INLINE_LEN bytes are always copied.
+	class iovec_sink
+	{
+	public:
+		explicit iovec_sink(uint32_t ref_threshold = 1024)
+			:_ref_threshold(ref_threshold),_scratch(256),_scratch_size(0),_size(0)
+		{
+		}
+		char* reserve(uint32_t n)
+		{
+			if(_scratch.size() - _scratch_size < n)
+			{
+				size_t capacity = _scratch.size() * 2;
+				_scratch.resize(capacity < _scratch_size + n ? _scratch_size + n : capacity);
+			}
+			return &_scratch[_scratch_size];
+		}
+		void commit(uint32_t n)
+		{
+			if(_segments.empty() || _segments.back().data != NULL)
+			{
+				_segment seg = {NULL,_scratch_size,0};
+				_segments.push_back(seg);
+			}
+			_segments.back().len += n;
+			_scratch_size += n;
+			_size += n;
+		}
+		void write(const char* data,uint32_t n)
+		{
+			if(n < _ref_threshold)
+			{
+				memcpy(reserve(n),data,n);
+				commit(n);
+				return;
+			}
+			_segment seg = {data,0,n};
+			_segments.push_back(seg);
+			_size += n;
+		}
+		//valid until the next write to the sink
+		const struct iovec* iovecs()
+		{
+			_iovecs.resize(_segments.size());
+			for(size_t i = 0; i < _segments.size(); i++)
+			{
+				const char* data = _segments[i].data ? _segments[i].data : &_scratch[0] + _segments[i].offset;
+				_iovecs[i].iov_base = (void*)data;
+				_iovecs[i].iov_len = _segments[i].len;
+			}
+			return _iovecs.empty() ? NULL : &_iovecs[0];
+		}
+		//writev accepts at most IOV_MAX segments per call
+		int iovec_count() const
+		{
+			return (int)_segments.size();
+		}
+		uint32_t size() const
+		{
+			return _size;
+		}
+		void clear()
+		{
+			_segments.clear();
+			_scratch_size = 0;
+			_size = 0;
+		}
+	private:
+		struct _segment
+		{
+			const char* data;
+			uint32_t offset;
+			uint32_t len;
+		};
+	private:
+		uint32_t _ref_threshold;
+		std::vector<char> _scratch;
+		uint32_t _scratch_size;
+		uint32_t _size;
+		std::vector<_segment> _segments;
+		std::vector<struct iovec> _iovecs;
+	};
+#endif
+
+	//monotonic arena, allocation is a pointer bump and memory is only given back by reset(),
+	//which keeps the blocks for the next round, a worker resets it once per message.
+	class monotonic_arena
+	{
+	public:
+		explicit monotonic_arena(size_t block_size = 64 * 1024)
+			:_block_size(block_size),_index(0),_cur(NULL),_end(NULL)
+		{
+		}
+		~monotonic_arena()
+		{
+			for(size_t i = 0; i < _blocks.size(); i++)
+				::operator delete(_blocks[i].data);
+		}
+		void* allocate(size_t n,size_t align = 16)
+		{
+			char* p = _align(_cur,align);
+			if(_cur == NULL || n > (size_t)(_end - p))
+			{
+				_next_block(n + align);
+				p = _align(_cur,align);
+			}
+			_cur = p + n;
+			return p;
+		}
+		void reset()
+		{
+			_index = 0;
+			_cur = _blocks.empty() ? NULL : _blocks[0].data;
+			_end = _blocks.empty() ? NULL : _blocks[0].data + _blocks[0].size;
+		}
+	private:
+		struct _block
+		{
+			char* data;
+			size_t size;
+		};
+	private:
+		static char* _align(char* p,size_t align)
+		{
+			return (char*)(((size_t)p + align - 1) & ~(align - 1));
+		}
+		void _next_block(size_t n)
+		{
+			if(_cur != NULL)
+				++_index;
+			while(_index < _blocks.size() && _blocks[_index].size < n)
+				++_index;
+			if(_index == _blocks.size())
+			{
+				_block b;
+				b.size = n > _block_size ? n : _block_size;
+				b.data = (char*)::operator new(b.size);
+				_blocks.push_back(b);
+			}
+			_cur = _blocks[_index].data;
+			_end = _cur + _blocks[_index].size;
+		}
+	private:
+		monotonic_arena(const monotonic_arena&);
+		monotonic_arena& operator=(const monotonic_arena&);
+	private:
+		size_t _block_size;
+		std::vector<_block> _blocks;
+		size_t _index;
+		char* _cur;
+		char* _end;
+	};
+
+	//makes arena the current arena of this thread while the scope lives
+	class arena_scope
+	{
+	public:
+		explicit arena_scope(monotonic_arena& arena)
+			:_prev(current())
+		{
+			current() = &arena;
+		}
+		~arena_scope()
+		{
+			current() = _prev;
+		}
+		static monotonic_arena*& current()
+		{
+			static _BINPROTO_THREAD_LOCAL monotonic_arena* arena = NULL;
+			return arena;
+		}
+	private:
+		arena_scope(const arena_scope&);
+		arena_scope& operator=(const arena_scope&);
+	private:
+		monotonic_arena* _prev;
+	};
+
+	//allocator bound to the current arena of the thread when it is constructed, or to the heap when there is none,
+	//so default constructed packets inside an arena_scope allocate all their strings and lists from the arena.
+	//objects allocated from an arena must be destroyed before the arena is reset.
+	//with c++17 std::pmr::polymorphic_allocator can be passed as alloc_type as well.
+	template<typename T>
+	class arena_allocator
+	{
+	public:
+		typedef T value_type;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+		template<typename U>
+		struct rebind
+		{
+			typedef arena_allocator<U> other;
+		};
+	public:
+		arena_allocator()
+			:_arena(arena_scope::current())
+		{
+		}
+		template<typename U>
+		arena_allocator(const arena_allocator<U>& other)
+			:_arena(other.arena())
+		{
+		}
+		pointer allocate(size_type n,const void* = 0)
+		{
+			if(_arena)
+				return (pointer)_arena->allocate(n * sizeof(T));
+			return (pointer)::operator new(n * sizeof(T));
+		}
+		void deallocate(pointer p,size_type)
+		{
+			if(!_arena)
+				::operator delete(p);
+		}
+		void construct(pointer p,const T& val)
+		{
+			new((void*)p) T(val);
+		}
+		void destroy(pointer p)
+		{
+			p->~T();
+		}
+		pointer address(reference x) const
+		{
+			return &x;
+		}
+		const_pointer address(const_reference x) const
+		{
+			return &x;
+		}
+		size_type max_size() const
+		{
+			return size_type(-1) / sizeof(T);
+		}
+		monotonic_arena* arena() const
+		{
+			return _arena;
+		}
+		template<typename U>
+		bool operator==(const arena_allocator<U>& other) const
+		{
+			return _arena == other.arena();
+		}
+		template<typename U>
+		bool operator!=(const arena_allocator<U>& other) const
+		{
+			return _arena != other.arena();
+		}
+	private:
+		monotonic_arena* _arena;
+	};
+
+	//wire byte order of num_obj, big endian is the network order and the default,
+	//the order that matches the host is a plain load and store.
+	struct big_endian
+	{
+#ifdef _BINPROTO_BIG_ENDIAN_HOST
+		static const bool need_swap = false;
+#else
+		static const bool need_swap = true;
+#endif
+	};
+	struct little_endian
+	{
+		static const bool need_swap = !big_endian::need_swap;
+	};
+
+	template<typename numtype, typename byte_order_type = BINPROTO_DEFAULT_BYTE_ORDER>
+	class num_obj
+	{
+	public:
+		typedef numtype uint_type;
+		typedef byte_order_type byte_order;
+		typedef typename _binproto_num_type_traits<numtype>::bits_type bits_type;
+		static const int STATIC_BINARY_LENGTH = BINPROTO_UINT_SIZE(numtype);
+	public:
+		num_obj()
+			:_num(0)
+		{
+		}
+		num_obj(numtype num)
+			:_num(num)
+		{
+		}
+		num_obj(const num_obj& num)
+			:_num(num._num)
+		{
+		}
+		num_obj& operator=(numtype num)
+		{
+			_num = num;
 			return *this;
 		}
-		fixed_len_string& assign(const char* str, uint32_t size)
+		num_obj& operator=(const num_obj& num)
 		{
-			BINPROTO_ASSERT(size <= STATIC_BINARY_LENGTH,"str len must not larger than template str_len value");
-			memcpy(_str,str,size);
-			memset(_str+size,0,STATIC_BINARY_LENGTH - size);
+			_num = num._num;
 			return *this;
 		}
-		std::string to_string() const
+		numtype to_int() const
 		{
-			return std::string(_str,STATIC_BINARY_LENGTH);
+			return _num;
 		}
-		std::string trim() const
+		bool operator<(const num_obj& other) const
 		{
-			return std::string(_str,strlen(_str));
+			return _num < other._num;
 		}
-		const char* c_str() const
+		bool operator==(const num_obj& other) const
 		{
-			return _str;
+			return _num == other._num;
 		}
-		bool operator<(const fixed_len_string& other) const
+		bool operator>(const num_obj& other) const
 		{
-			return memcmp(_str,other._str,STATIC_BINARY_LENGTH) < 0;
+			return _num > other._num;
 		}
-		bool operator==(const fixed_len_string& other) const
+		bool operator!=(const num_obj& other) const
 		{
-			return memcmp(_str,other._str,STATIC_BINARY_LENGTH) == 0;
+			return _num != other._num;
 		}
-		bool operator>(const fixed_len_string& other) const
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const
 		{
-			return memcmp(_str,other._str,STATIC_BINARY_LENGTH) > 0;
+			BINPROTO_ASSERT(bufflen >= STATIC_BINARY_LENGTH,"num_obj serialize error");
+			(void)bufflen;
+			bits_type wire_num;
+			memcpy(&wire_num,&_num,STATIC_BINARY_LENGTH);
+			if(byte_order::need_swap)
+				wire_num = _binproto_bswap(wire_num);
+			memcpy(buffer,&wire_num,STATIC_BINARY_LENGTH);
+			return STATIC_BINARY_LENGTH;
 		}
-		bool operator!=(const fixed_len_string& other) const
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			serialize_to_buffer(sink.reserve(STATIC_BINARY_LENGTH),STATIC_BINARY_LENGTH);
+			sink.commit(STATIC_BINARY_LENGTH);
+			return STATIC_BINARY_LENGTH;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(bufflen >= STATIC_BINARY_LENGTH,_binproto_num_type_traits<numtype>::parse_error());
+			bits_type wire_num;
+			memcpy(&wire_num,buffer,STATIC_BINARY_LENGTH);
+			if(byte_order::need_swap)
+				wire_num = _binproto_bswap(wire_num);
+			memcpy(&_num,&wire_num,STATIC_BINARY_LENGTH);
+			return STATIC_BINARY_LENGTH;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			if(bufflen < STATIC_BINARY_LENGTH)
+				return status.fail(parse_status::short_buffer);
+			return parse_from_buffer(buffer,bufflen);
+		}
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			parse_cursor::frame& frame = cursor.at(depth);
+			if(frame.partial_len == 0 && bufflen >= STATIC_BINARY_LENGTH)
+			{
+				parse_from_buffer(buffer,bufflen);
+				buffer += STATIC_BINARY_LENGTH;
+				bufflen -= STATIC_BINARY_LENGTH;
+				return true;
+			}
+			uint32_t n = STATIC_BINARY_LENGTH - frame.partial_len;
+			n = n < bufflen ? n : bufflen;
+			memcpy(frame.partial + frame.partial_len,buffer,n);
+			frame.partial_len += n;
+			buffer += n;
+			bufflen -= n;
+			if(frame.partial_len < STATIC_BINARY_LENGTH)
+				return false;
+			parse_from_buffer(frame.partial,STATIC_BINARY_LENGTH);
+			return true;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return STATIC_BINARY_LENGTH;
+		}
+		static uint32_t skip_from_buffer(const char*,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(bufflen >= STATIC_BINARY_LENGTH,"num_obj parse error");
+			return STATIC_BINARY_LENGTH;
+		}
+		static uint32_t validate_buffer(const char*,uint32_t bufflen)
+		{
+			return bufflen >= STATIC_BINARY_LENGTH ? STATIC_BINARY_LENGTH : 0;
+		}
+	private:
+		numtype _num;
+	};
+
+	typedef num_obj<uint8_t> uint8_obj;
+	typedef num_obj<uint16_t> uint16_obj;
+	typedef num_obj<uint32_t> uint32_obj;
+	typedef num_obj<uint64_t> uint64_obj;
+	typedef num_obj<uint16_t,big_endian> uint16_be_obj;
+	typedef num_obj<uint32_t,big_endian> uint32_be_obj;
+	typedef num_obj<uint64_t,big_endian> uint64_be_obj;
+	typedef num_obj<uint16_t,little_endian> uint16_le_obj;
+	typedef num_obj<uint32_t,little_endian> uint32_le_obj;
+	typedef num_obj<uint64_t,little_endian> uint64_le_obj;
+	typedef num_obj<int8_t> int8_obj;
+	typedef num_obj<int16_t> int16_obj;
+	typedef num_obj<int32_t> int32_obj;
+	typedef num_obj<int64_t> int64_obj;
+	typedef num_obj<float> float32_obj;
+	typedef num_obj<double> float64_obj;
+	typedef num_obj<int16_t,big_endian> int16_be_obj;
+	typedef num_obj<int32_t,big_endian> int32_be_obj;
+	typedef num_obj<int64_t,big_endian> int64_be_obj;
+	typedef num_obj<float,big_endian> float32_be_obj;
+	typedef num_obj<double,big_endian> float64_be_obj;
+	typedef num_obj<int16_t,little_endian> int16_le_obj;
+	typedef num_obj<int32_t,little_endian> int32_le_obj;
+	typedef num_obj<int64_t,little_endian> int64_le_obj;
+	typedef num_obj<float,little_endian> float32_le_obj;
+	typedef num_obj<double,little_endian> float64_le_obj;
+
+	template<typename obj_type>
+	struct _is_num_obj
+	{
+		static const bool value = false;
+	};
+	template<typename numtype, typename byte_order>
+	struct _is_num_obj<num_obj<numtype,byte_order> >
+	{
+		BINPROTO_STATIC_ASSERT(sizeof(num_obj<numtype,byte_order>) == sizeof(numtype),"num_obj must have the layout of its number");
+		static const bool value = true;
+	};
+
+	//swaps the bytes of n numbers of num_size bytes from src to dst,
+	//the swap is its own inverse, so the same loop decodes a list into num_obj elements and encodes it.
+	template<int num_size>
+	struct _bulk_byteswap;
+
+	template<>
+	struct _bulk_byteswap<1>
+	{
+		static void run(const char* src,char* dst,uint32_t n)
+		{
+			memcpy(dst,src,n);
+		}
+	};
+	template<>
+	struct _bulk_byteswap<2>
+	{
+		static void run(const char* src,char* dst,uint32_t n)
+		{
+			uint32_t i = 0;
+#ifdef _BINPROTO_SIMD_AVX2
+			const __m256i mask32 = _mm256_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14,1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14);
+			for(; i + 16 <= n; i += 16)
+				_mm256_storeu_si256((__m256i*)(dst + i * 2),_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 2)),mask32));
+#endif
+#ifdef _BINPROTO_SIMD_SSSE3
+			const __m128i mask = _mm_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14);
+			for(; i + 8 <= n; i += 8)
+				_mm_storeu_si128((__m128i*)(dst + i * 2),_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 2)),mask));
+#endif
+			for(; i < n; i++)
+			{
+				uint16_t num;
+				memcpy(&num,src + i * 2,2);
+				num = _binproto_bswap16(num);
+				memcpy(dst + i * 2,&num,2);
+			}
+		}
+	};
+	template<>
+	struct _bulk_byteswap<4>
+	{
+		static void run(const char* src,char* dst,uint32_t n)
+		{
+			uint32_t i = 0;
+#ifdef _BINPROTO_SIMD_AVX2
+			const __m256i mask32 = _mm256_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12);
+			for(; i + 8 <= n; i += 8)
+				_mm256_storeu_si256((__m256i*)(dst + i * 4),_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 4)),mask32));
+#endif
+#ifdef _BINPROTO_SIMD_SSSE3
+			const __m128i mask = _mm_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12);
+			for(; i + 4 <= n; i += 4)
+				_mm_storeu_si128((__m128i*)(dst + i * 4),_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 4)),mask));
+#endif
+			for(; i < n; i++)
+			{
+				uint32_t num;
+				memcpy(&num,src + i * 4,4);
+				num = _binproto_bswap32(num);
+				memcpy(dst + i * 4,&num,4);
+			}
+		}
+	};
+	template<>
+	struct _bulk_byteswap<8>
+	{
+		static void run(const char* src,char* dst,uint32_t n)
+		{
+			uint32_t i = 0;
+#ifdef _BINPROTO_SIMD_AVX2
+			const __m256i mask32 = _mm256_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8);
+			for(; i + 4 <= n; i += 4)
+				_mm256_storeu_si256((__m256i*)(dst + i * 8),_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 8)),mask32));
+#endif
+#ifdef _BINPROTO_SIMD_SSSE3
+			const __m128i mask = _mm_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8);
+			for(; i + 2 <= n; i += 2)
+				_mm_storeu_si128((__m128i*)(dst + i * 8),_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 8)),mask));
+#endif
+			for(; i < n; i++)
+			{
+				uint64_t num;
+				memcpy(&num,src + i * 8,8);
+				num = _binproto_bswap64(num);
+				memcpy(dst + i * 8,&num,8);
+			}
+		}
+	};
+
+	//base 128 varint codec, 7 bits per byte starting from the low bits, the high bit marks that more bytes follow
+	template<typename wire_type>
+	struct _varint
+	{
+		static const int BITS = sizeof(wire_type) * 8;
+		static const uint32_t MAX_LENGTH = (BITS + 6) / 7;
+
+		static uint32_t length(wire_type num)
+		{
+			uint32_t len = 1;
+			while(num >= 0x80)
+			{
+				num >>= 7;
+				++len;
+			}
+			return len;
+		}
+		static uint32_t encode(wire_type num,char* buffer)
+		{
+			uint32_t len = 0;
+			while(num >= 0x80)
+			{
+				buffer[len++] = (char)(num | 0x80);
+				num >>= 7;
+			}
+			buffer[len++] = (char)num;
+			return len;
+		}
+		//returns the encoded length, or 0 when the buffer ends inside the varint or the varint overflows wire_type,
+		//the buffer can only be short when bufflen < MAX_LENGTH.
+		static uint32_t decode(const char* buffer,uint32_t bufflen,wire_type& num)
+		{
+			uint32_t limit = bufflen < MAX_LENGTH ? bufflen : MAX_LENGTH;
+			wire_type result = 0;
+			for(uint32_t i = 0; i < limit; i++)
+			{
+				uint8_t byte = buffer[i];
+				if(i == MAX_LENGTH - 1 && ((byte & 0x7F) >> (BITS - 7 * i)) != 0)
+					return 0;
+				result |= (wire_type)(byte & 0x7F) << (7 * i);
+				if(!(byte & 0x80))
+				{
+					num = result;
+					return i + 1;
+				}
+			}
+			return 0;
+		}
+		static parse_status::error_code decode_error(uint32_t bufflen)
+		{
+			return bufflen < MAX_LENGTH ? parse_status::short_buffer : parse_status::invalid_data;
+		}
+		//collects the bits in frame.count, a varint which overflows wire_type fails the cursor as decode() does
+		static bool decode_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth,wire_type& num)
+		{
+			parse_cursor::frame& frame = cursor.at(depth);
+			while(bufflen > 0)
+			{
+				uint8_t byte = *buffer;
+				++buffer;
+				--bufflen;
+				if(frame.partial_len == MAX_LENGTH - 1 && ((byte & 0x7F) >> (BITS - 7 * frame.partial_len)) != 0)
+					return cursor.fail();
+				frame.count |= (uint64_t)(byte & 0x7F) << (7 * frame.partial_len);
+				++frame.partial_len;
+				if(!(byte & 0x80))
+				{
+					num = (wire_type)frame.count;
+					return true;
+				}
+				if(frame.partial_len == MAX_LENGTH)
+					return cursor.fail();
+			}
+			return false;
+		}
+		//decodes n varints into objs, returns the bytes used, or 0 when the run is malformed.
+		//while 8 bytes are readable they are loaded as one word: a word without continuation bits is 8 one-byte values,
+		//otherwise the first stop bit gives the length and the 7 bit groups are packed with three shift-and-mask steps.
+		template<typename obj_type>
+		static uint32_t decode_run(const char* buffer,uint32_t bufflen,obj_type* objs,uint32_t n)
+		{
+			uint32_t pos = 0;
+			uint32_t i = 0;
+			while(i < n)
+			{
+				if(bufflen - pos >= 8)
+				{
+					uint64_t word;
+					memcpy(&word,buffer + pos,8);
+#ifdef _BINPROTO_BIG_ENDIAN_HOST
+					word = _binproto_bswap64(word);
+#endif
+					uint64_t stops = ~word & 0x8080808080808080ULL;
+					if(stops == 0x8080808080808080ULL && n - i >= 8)
+					{
+						for(uint32_t k = 0; k < 8; k++)
+							objs[i + k]._assign_wire((wire_type)(uint8_t)(word >> (8 * k)));
+						i += 8;
+						pos += 8;
+						continue;
+					}
+					if(stops != 0)
+					{
+						uint32_t len = _binproto_ctz64(stops) / 8 + 1;
+						if(len > MAX_LENGTH)
+							return 0;
+						uint64_t x = word & (stops ^ (stops - 1)) & 0x7F7F7F7F7F7F7F7FULL;
+						x = ((x & 0x7F007F007F007F00ULL) >> 1) | (x & 0x007F007F007F007FULL);
+						x = ((x & 0x3FFF00003FFF0000ULL) >> 2) | (x & 0x00003FFF00003FFFULL);
+						x = ((x & 0x0FFFFFFF00000000ULL) >> 4) | (x & 0x000000000FFFFFFFULL);
+						if((x >> (BITS - 1) >> 1) != 0)
+							return 0;
+						objs[i]._assign_wire((wire_type)x);
+						pos += len;
+						++i;
+						continue;
+					}
+				}
+				wire_type num;
+				uint32_t len = decode(buffer + pos,bufflen - pos,num);
+				if(len == 0)
+					return 0;
+				objs[i]._assign_wire(num);
+				pos += len;
+				++i;
+			}
+			return pos;
+		}
+	};
+
+	//unsigned integer encoded as a varint, small values take fewer bytes
+	template<typename numtype>
+	class varint_obj
+	{
+	public:
+		typedef numtype uint_type;
+		typedef numtype wire_type;
+		static const int STATIC_BINARY_LENGTH = 0;
+	public:
+		varint_obj()
+			:_num(0)
+		{
+		}
+		varint_obj(numtype num)
+			:_num(num)
+		{
+		}
+		varint_obj& operator=(numtype num)
+		{
+			_num = num;
+			return *this;
+		}
+		numtype to_int() const
+		{
+			return _num;
+		}
+		bool operator<(const varint_obj& other) const
+		{
+			return _num < other._num;
+		}
+		bool operator==(const varint_obj& other) const
+		{
+			return _num == other._num;
+		}
+		bool operator>(const varint_obj& other) const
+		{
+			return _num > other._num;
+		}
+		bool operator!=(const varint_obj& other) const
+		{
+			return _num != other._num;
+		}
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const
+		{
+			BINPROTO_ASSERT(_varint<wire_type>::length(_num) <= bufflen,"varint_obj serialize error");
+			(void)bufflen;
+			return _varint<wire_type>::encode(_num,buffer);
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			uint32_t len = _varint<wire_type>::encode(_num,sink.reserve(_varint<wire_type>::MAX_LENGTH));
+			sink.commit(len);
+			return len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			uint32_t len = _varint<wire_type>::decode(buffer,bufflen,_num);
+			_BINPROTO_PARSE_ENSURE(len != 0,"varint_obj parse error");
+			return len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			uint32_t len = _varint<wire_type>::decode(buffer,bufflen,_num);
+			if(len == 0)
+				return status.fail(_varint<wire_type>::decode_error(bufflen));
+			return len;
+		}
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			return _varint<wire_type>::decode_some(buffer,bufflen,cursor,depth,_num);
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return _varint<wire_type>::length(_num);
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			wire_type num;
+			uint32_t len = _varint<wire_type>::decode(buffer,bufflen,num);
+			_BINPROTO_PARSE_ENSURE(len != 0,"varint_obj parse error");
+			return len;
+		}
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			wire_type num;
+			return _varint<wire_type>::decode(buffer,bufflen,num);
+		}
+		void _assign_wire(wire_type num)
+		{
+			_num = num;
+		}
+	private:
+		numtype _num;
+	};
+
+	typedef varint_obj<uint16_t> varint16_obj;
+	typedef varint_obj<uint32_t> varint32_obj;
+	typedef varint_obj<uint64_t> varint64_obj;
+
+	template<typename signed_type>
+	struct _zigzag_traits;
+	template<> struct _zigzag_traits<int16_t>{typedef uint16_t wire_type;};
+	template<> struct _zigzag_traits<int32_t>{typedef uint32_t wire_type;};
+	template<> struct _zigzag_traits<int64_t>{typedef uint64_t wire_type;};
+
+	//signed integer encoded as a varint of its zigzag mapping 0,-1,1,-2,... -> 0,1,2,3,...
+	//so values near zero of either sign take fewer bytes
+	template<typename numtype>
+	class zigzag_obj
+	{
+	public:
+		typedef numtype int_type;
+		typedef typename _zigzag_traits<numtype>::wire_type wire_type;
+		static const int STATIC_BINARY_LENGTH = 0;
+	public:
+		zigzag_obj()
+			:_num(0)
+		{
+		}
+		zigzag_obj(numtype num)
+			:_num(num)
+		{
+		}
+		zigzag_obj& operator=(numtype num)
+		{
+			_num = num;
+			return *this;
+		}
+		numtype to_int() const
+		{
+			return _num;
+		}
+		bool operator<(const zigzag_obj& other) const
+		{
+			return _num < other._num;
+		}
+		bool operator==(const zigzag_obj& other) const
+		{
+			return _num == other._num;
+		}
+		bool operator>(const zigzag_obj& other) const
+		{
+			return _num > other._num;
+		}
+		bool operator!=(const zigzag_obj& other) const
+		{
+			return _num != other._num;
+		}
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const
+		{
+			BINPROTO_ASSERT(_varint<wire_type>::length(_to_wire()) <= bufflen,"zigzag_obj serialize error");
+			(void)bufflen;
+			return _varint<wire_type>::encode(_to_wire(),buffer);
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			uint32_t len = _varint<wire_type>::encode(_to_wire(),sink.reserve(_varint<wire_type>::MAX_LENGTH));
+			sink.commit(len);
+			return len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			wire_type num;
+			uint32_t len = _varint<wire_type>::decode(buffer,bufflen,num);
+			_BINPROTO_PARSE_ENSURE(len != 0,"zigzag_obj parse error");
+			_assign_wire(num);
+			return len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			wire_type num;
+			uint32_t len = _varint<wire_type>::decode(buffer,bufflen,num);
+			if(len == 0)
+				return status.fail(_varint<wire_type>::decode_error(bufflen));
+			_assign_wire(num);
+			return len;
+		}
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			wire_type num;
+			if(!_varint<wire_type>::decode_some(buffer,bufflen,cursor,depth,num))
+				return false;
+			_assign_wire(num);
+			return true;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return _varint<wire_type>::length(_to_wire());
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			wire_type num;
+			uint32_t len = _varint<wire_type>::decode(buffer,bufflen,num);
+			_BINPROTO_PARSE_ENSURE(len != 0,"zigzag_obj parse error");
+			return len;
+		}
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			wire_type num;
+			return _varint<wire_type>::decode(buffer,bufflen,num);
+		}
+		void _assign_wire(wire_type num)
+		{
+			_num = (numtype)((num >> 1) ^ (wire_type)(0 - (num & 1)));
+		}
+	private:
+		wire_type _to_wire() const
+		{
+			return _num < 0 ? (wire_type)~((wire_type)_num << 1) : (wire_type)((wire_type)_num << 1);
+		}
+	private:
+		numtype _num;
+	};
+
+	typedef zigzag_obj<int16_t> zigzag16_obj;
+	typedef zigzag_obj<int32_t> zigzag32_obj;
+	typedef zigzag_obj<int64_t> zigzag64_obj;
+
+	template<typename obj_type>
+	struct _is_varint_obj
+	{
+		static const bool value = false;
+	};
+	template<typename numtype>
+	struct _is_varint_obj<varint_obj<numtype> >
+	{
+		static const bool value = true;
+	};
+	template<typename numtype>
+	struct _is_varint_obj<zigzag_obj<numtype> >
+	{
+		static const bool value = true;
+	};
+
+	//widths and bit ends of the fields of a bit_field_group, the end of field index is w0 + ... + windex
+	template<int index,int w0,int w1,int w2,int w3,int w4,int w5,int w6,int w7,int w8,int w9,int w10,int w11,int w12,int w13,int w14,int w15>
+	struct _bit_field_at
+	{
+		typedef _bit_field_at<index - 1,w1,w2,w3,w4,w5,w6,w7,w8,w9,w10,w11,w12,w13,w14,w15,0> next;
+		enum{width = next::width,end = w0 + next::end};
+	};
+	template<int w0,int w1,int w2,int w3,int w4,int w5,int w6,int w7,int w8,int w9,int w10,int w11,int w12,int w13,int w14,int w15>
+	struct _bit_field_at<0,w0,w1,w2,w3,w4,w5,w6,w7,w8,w9,w10,w11,w12,w13,w14,w15>
+	{
+		enum{width = w0,end = w0};
+	};
+	//the field of a compile-time index, the check is at class scope so it leaves no unused local typedef
+	template<int index,int w0,int w1,int w2,int w3,int w4,int w5,int w6,int w7,int w8,int w9,int w10,int w11,int w12,int w13,int w14,int w15>
+	struct _bit_field_checked
+	{
+		typedef _bit_field_at<index,w0,w1,w2,w3,w4,w5,w6,w7,w8,w9,w10,w11,w12,w13,w14,w15> field;
+		BINPROTO_STATIC_ASSERT(index >= 0 && index < 16 && field::width > 0,"bit_field_group field index out of range");
+		enum{width = field::width,end = field::end};
+	};
+
+	//packs fields of w0, w1, ... bits into the fewest whole bytes, up to 16 fields and 64 bits.
+	//the group is a big endian number, field 0 takes the most significant bits and unused low bits are zero,
+	//so bit_field_group<4,4> is the version and header length byte of an ip header.
+	template<int w0, int w1 = 0, int w2 = 0, int w3 = 0, int w4 = 0, int w5 = 0, int w6 = 0, int w7 = 0, int w8 = 0, int w9 = 0, int w10 = 0, int w11 = 0, int w12 = 0, int w13 = 0, int w14 = 0, int w15 = 0>
+	class bit_field_group
+	{
+	public:
+		enum{BITS = w0+w1+w2+w3+w4+w5+w6+w7+w8+w9+w10+w11+w12+w13+w14+w15};
+		static const int STATIC_BINARY_LENGTH = (BITS + 7) / 8;
+		BINPROTO_STATIC_ASSERT(BITS > 0 && BITS <= 64,"bit_field_group must have 1 to 64 bits");
+	public:
+		bit_field_group()
+			:_bits(0)
+		{
+		}
+		template<int index>
+		uint64_t get() const
+		{
+			typedef _bit_field_checked<index,w0,w1,w2,w3,w4,w5,w6,w7,w8,w9,w10,w11,w12,w13,w14,w15> field;
+			return (_bits >> (STATIC_BINARY_LENGTH * 8 - field::end)) & _mask(field::width);
+		}
+		template<int index>
+		void set(uint64_t value)
+		{
+			typedef _bit_field_checked<index,w0,w1,w2,w3,w4,w5,w6,w7,w8,w9,w10,w11,w12,w13,w14,w15> field;
+			_set(STATIC_BINARY_LENGTH * 8 - field::end,field::width,value);
+		}
+		//run-time index, for code which walks the fields
+		uint64_t get(int index) const
+		{
+			BINPROTO_ASSERT(index >= 0 && index < 16 && _width(index) > 0,"bit_field_group field index out of range");
+			return (_bits >> (STATIC_BINARY_LENGTH * 8 - _end(index))) & _mask(_width(index));
+		}
+		void set(int index,uint64_t value)
+		{
+			BINPROTO_ASSERT(index >= 0 && index < 16 && _width(index) > 0,"bit_field_group field index out of range");
+			_set(STATIC_BINARY_LENGTH * 8 - _end(index),_width(index),value);
+		}
+		uint64_t to_int() const
+		{
+			return _bits;
+		}
+		bool operator==(const bit_field_group& other) const
+		{
+			return _bits == other._bits;
+		}
+		bool operator!=(const bit_field_group& other) const
+		{
+			return _bits != other._bits;
+		}
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const
+		{
+			BINPROTO_ASSERT(bufflen >= STATIC_BINARY_LENGTH,"bit_field_group serialize error");
+			(void)bufflen;
+			for(int i = 0; i < STATIC_BINARY_LENGTH; i++)
+				buffer[i] = (char)(_bits >> (8 * (STATIC_BINARY_LENGTH - 1 - i)));
+			return STATIC_BINARY_LENGTH;
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			serialize_to_buffer(sink.reserve(STATIC_BINARY_LENGTH),STATIC_BINARY_LENGTH);
+			sink.commit(STATIC_BINARY_LENGTH);
+			return STATIC_BINARY_LENGTH;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(bufflen >= STATIC_BINARY_LENGTH,"bit_field_group parse error");
+			uint64_t bits = 0;
+			for(int i = 0; i < STATIC_BINARY_LENGTH; i++)
+				bits = (bits << 8) | (uint8_t)buffer[i];
+			_bits = bits;
+			return STATIC_BINARY_LENGTH;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			if(bufflen < STATIC_BINARY_LENGTH)
+				return status.fail(parse_status::short_buffer);
+			return parse_from_buffer(buffer,bufflen);
+		}
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			parse_cursor::frame& frame = cursor.at(depth);
+			if(frame.partial_len == 0 && bufflen >= STATIC_BINARY_LENGTH)
+			{
+				parse_from_buffer(buffer,bufflen);
+				buffer += STATIC_BINARY_LENGTH;
+				bufflen -= STATIC_BINARY_LENGTH;
+				return true;
+			}
+			uint32_t n = STATIC_BINARY_LENGTH - frame.partial_len;
+			n = n < bufflen ? n : bufflen;
+			memcpy(frame.partial + frame.partial_len,buffer,n);
+			frame.partial_len += n;
+			buffer += n;
+			bufflen -= n;
+			if(frame.partial_len < STATIC_BINARY_LENGTH)
+				return false;
+			parse_from_buffer(frame.partial,STATIC_BINARY_LENGTH);
+			return true;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return STATIC_BINARY_LENGTH;
+		}
+		static uint32_t skip_from_buffer(const char*,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(bufflen >= STATIC_BINARY_LENGTH,"bit_field_group parse error");
+			return STATIC_BINARY_LENGTH;
+		}
+		static uint32_t validate_buffer(const char*,uint32_t bufflen)
+		{
+			return bufflen >= STATIC_BINARY_LENGTH ? STATIC_BINARY_LENGTH : 0;
+		}
+	private:
+		static uint64_t _mask(int width)
+		{
+			return ((((uint64_t)1) << (width - 1)) << 1) - 1;
+		}
+		static int _width(int index)
+		{
+			static const int widths[16] = {w0,w1,w2,w3,w4,w5,w6,w7,w8,w9,w10,w11,w12,w13,w14,w15};
+			return widths[index];
+		}
+		static int _end(int index)
+		{
+			int end = 0;
+			for(int i = 0; i <= index; i++)
+				end += _width(i);
+			return end;
+		}
+		void _set(int shift,int width,uint64_t value)
+		{
+			BINPROTO_ASSERT((value & ~_mask(width)) == 0,"bit_field_group value does not fit its field");
+			_bits = (_bits & ~(_mask(width) << shift)) | ((value & _mask(width)) << shift);
+		}
+	private:
+		uint64_t _bits;
+	};
+
+	template<int len_size, typename alloc_type = BINPROTO_DEFAULT_ALLOCATOR(char) >
+	class variable_len_string
+	{
+	public:
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(len_size)> len_type;
+		typedef std::basic_string<char,std::char_traits<char>,alloc_type> string_type;
+		static const int STATIC_BINARY_LENGTH = 0;
+	public:
+		variable_len_string(){}
+		explicit variable_len_string(const alloc_type& alloc):_str(alloc){}
+		variable_len_string(const char* str)
+		{
+			BINPROTO_ASSERT(strlen(str) <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+			_str = str;
+		}
+		variable_len_string(const char* str, uint32_t size)
+		{
+			BINPROTO_ASSERT(size <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+			_str.assign(str,size);
+		}
+		variable_len_string(const std::string& str):_str(str.data(),str.size()){
+			BINPROTO_ASSERT(str.size() <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+		}
+		variable_len_string(const variable_len_string& str):_str(str._str){}
+		variable_len_string& operator=(const std::string& str)
+		{
+			BINPROTO_ASSERT(str.size() <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+			_str.assign(str.data(),str.size());
+			return *this;
+		}
+		variable_len_string& operator=(const char* str)
+		{
+			BINPROTO_ASSERT(strlen(str) <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+			_str = str;
+			return *this;
+		}
+		variable_len_string& operator=(const variable_len_string& str)
+		{
+			_str = str._str;
+			return *this;
+		}
+		variable_len_string& assign(const char* str, uint32_t size)
+		{
+			BINPROTO_ASSERT(size <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+			_str.assign(str,size);
+			return *this;
+		}
+		const string_type& to_string() const
+		{
+			return _str;
+		}
+		std::string trim() const
+		{
+			return std::string(_str.c_str(),strlen(c_str()));
+		}
+		const char* c_str() const
+		{
+			return _str.c_str();
+		}
+		uint32_t size() const
+		{
+			return _str.size();
+		}
+		bool operator<(const variable_len_string& other) const
+		{
+			return _str < other._str;
+		}
+		bool operator==(const variable_len_string& other) const
+		{
+			return _str == other._str;
+		}
+		bool operator>(const variable_len_string& other) const
+		{
+			return _str > other._str;
+		}
+		bool operator!=(const variable_len_string& other) const
+		{
+			return _str != other._str;
+		}
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const 
+		{
+			BINPROTO_ASSERT(get_binary_len() <= bufflen,"variable_len_string serialize error");
+			uint32_t temp_len = 0;
+			temp_len+=len_type(_str.length()).serialize_to_buffer(buffer,bufflen);
+			memcpy(buffer+temp_len,_str.c_str(),_str.length());
+			temp_len += _str.size();
+			return temp_len;
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			if(_str.size() <= _BINPROTO_SINK_INLINE_LEN)
+			{
+				uint32_t temp_len = get_binary_len();
+				serialize_to_buffer(sink.reserve(temp_len),temp_len);
+				sink.commit(temp_len);
+				return temp_len;
+			}
+			uint32_t temp_len = len_type(_str.size()).serialize_to_sink(sink);
+			sink.write(_str.data(),_str.size());
+			return temp_len + _str.size();
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			uint32_t temp_len = 0;
+			len_type temp;
+			_BINPROTO_PARSE_ENSURE(bufflen >= temp.get_binary_len(),"variable_len_string parse error");
+			temp_len += temp.parse_from_buffer(buffer,bufflen);
+			_BINPROTO_PARSE_ENSURE(temp.to_int() <= bufflen - temp_len,"variable_len_string parse error");
+			_str.assign(buffer + temp_len,temp.to_int());
+			temp_len += temp.to_int();
+			return temp_len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			uint32_t temp_len = validate_buffer(buffer,bufflen);
+			if(temp_len == 0)
+				return status.fail(parse_status::short_buffer);
+			_str.assign(buffer + len_size,temp_len - len_size);
+			return temp_len;
+		}
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			if(cursor.at(depth).step == 0)
+			{
+				len_type temp;
+				if(!temp.parse_some(buffer,bufflen,cursor,depth + 1))
+					return false;
+				cursor.reset(depth + 1);
+				//no buffer holds a length past 32 bits
+				if(temp.to_int() > UINT32_MAX)
+					return cursor.fail();
+				parse_cursor::frame& frame = cursor.at(depth);
+				frame.step = 1;
+				frame.count = temp.to_int();
+				_str.clear();
+				//the length is not trusted for more than the bytes at hand, the string grows as they arrive
+				_str.reserve(temp.to_int() < bufflen ? temp.to_int() : bufflen);
+			}
+			uint64_t left = cursor.at(depth).count - _str.size();
+			uint32_t n = left < bufflen ? (uint32_t)left : bufflen;
+			_str.append(buffer,n);
+			buffer += n;
+			bufflen -= n;
+			return _str.size() == cursor.at(depth).count;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return len_size	+ _str.length();
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			len_type temp;
+			_BINPROTO_PARSE_ENSURE(bufflen >= temp.get_binary_len(),"variable_len_string parse error");
+			uint32_t temp_len = temp.parse_from_buffer(buffer,bufflen);
+			_BINPROTO_PARSE_ENSURE(temp.to_int() <= bufflen - temp_len,"variable_len_string parse error");
+			return temp_len + temp.to_int();
+		}
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			len_type temp;
+			if(bufflen < temp.get_binary_len())
+				return 0;
+			uint32_t temp_len = temp.parse_from_buffer(buffer,bufflen);
+			if(temp.to_int() > bufflen - temp_len)
+				return 0;
+			return temp_len + temp.to_int();
+		}
+	private:
+		string_type _str;
+	};
+
+	template<int str_len>
+	class fixed_len_string
+	{
+	public:
+		static const int STATIC_BINARY_LENGTH = str_len;
+	public:
+		fixed_len_string()
+		{
+			memset(_str, 0, STATIC_BINARY_LENGTH + 1);
+		}
+		fixed_len_string(const char* str)
+		{
+			_str[STATIC_BINARY_LENGTH] = 0;
+			*this = str;
+		}
+		fixed_len_string(const char* str, uint32_t size)
+		{
+			_str[STATIC_BINARY_LENGTH] = 0;
+			assign(str,size);
+		}
+		fixed_len_string(const std::string& str)
+		{
+			_str[STATIC_BINARY_LENGTH] = 0;
+			*this = str;
+		}
+		fixed_len_string(const fixed_len_string& str)
+		{
+			_str[STATIC_BINARY_LENGTH] = 0;
+			*this = str;
+		}
+		fixed_len_string& operator=(const std::string& str)
+		{
+			if(str.size() >= STATIC_BINARY_LENGTH)
+			{
+				memcpy(_str,str.c_str(),STATIC_BINARY_LENGTH);
+			}
+			else
+			{
+				memcpy(_str,str.c_str(),str.size());
+				memset(_str + str.size(),0,STATIC_BINARY_LENGTH - str.size());
+			}
+			return *this;
+		}
+		fixed_len_string& operator=(const char* str)
+		{
+			uint32_t paralen = strlen(str);
+			if(paralen >= STATIC_BINARY_LENGTH)
+			{
+				memcpy(_str,str,STATIC_BINARY_LENGTH);
+			}
+			else
+			{
+				memcpy(_str,str,paralen);
+				memset(_str + paralen,0,STATIC_BINARY_LENGTH - paralen);
+			}
+			return *this;
+		}
+		fixed_len_string& operator=(const fixed_len_string& packstring)
+		{
+			memcpy(_str,packstring._str,STATIC_BINARY_LENGTH);
+			return *this;
+		}
+		fixed_len_string& assign(const char* str, uint32_t size)
+		{
+			BINPROTO_ASSERT(size <= STATIC_BINARY_LENGTH,"str len must not larger than template str_len value");
+			memcpy(_str,str,size);
+			memset(_str+size,0,STATIC_BINARY_LENGTH - size);
+			return *this;
+		}
+		std::string to_string() const
+		{
+			return std::string(_str,STATIC_BINARY_LENGTH);
+		}
+		std::string trim() const
+		{
+			return std::string(_str,strlen(_str));
+		}
+		const char* c_str() const
+		{
+			return _str;
+		}
+		bool operator<(const fixed_len_string& other) const
+		{
+			return memcmp(_str,other._str,STATIC_BINARY_LENGTH) < 0;
+		}
+		bool operator==(const fixed_len_string& other) const
+		{
+			return memcmp(_str,other._str,STATIC_BINARY_LENGTH) == 0;
+		}
+		bool operator>(const fixed_len_string& other) const
+		{
+			return memcmp(_str,other._str,STATIC_BINARY_LENGTH) > 0;
+		}
+		bool operator!=(const fixed_len_string& other) const
+		{
+			return memcmp(_str,other._str,STATIC_BINARY_LENGTH) != 0;
+		}
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const 
+		{
+			BINPROTO_ASSERT(STATIC_BINARY_LENGTH <= bufflen,"fixed_len_string serialize error");
+			memcpy(buffer,_str,STATIC_BINARY_LENGTH);
+			return STATIC_BINARY_LENGTH;
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			serialize_to_buffer(sink.reserve(STATIC_BINARY_LENGTH),STATIC_BINARY_LENGTH);
+			sink.commit(STATIC_BINARY_LENGTH);
+			return STATIC_BINARY_LENGTH;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(STATIC_BINARY_LENGTH <= bufflen,"fixed_len_string parse error");
+			memcpy(_str,buffer,STATIC_BINARY_LENGTH);
+			return STATIC_BINARY_LENGTH;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			if(STATIC_BINARY_LENGTH > bufflen)
+				return status.fail(parse_status::short_buffer);
+			return parse_from_buffer(buffer,bufflen);
+		}
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			parse_cursor::frame& frame = cursor.at(depth);
+			uint32_t n = STATIC_BINARY_LENGTH - frame.partial_len;
+			n = n < bufflen ? n : bufflen;
+			memcpy(_str + frame.partial_len,buffer,n);
+			frame.partial_len += n;
+			buffer += n;
+			bufflen -= n;
+			return frame.partial_len == STATIC_BINARY_LENGTH;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return STATIC_BINARY_LENGTH;
+		}
+		static uint32_t skip_from_buffer(const char*,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(STATIC_BINARY_LENGTH <= bufflen,"fixed_len_string parse error");
+			return STATIC_BINARY_LENGTH;
+		}
+		static uint32_t validate_buffer(const char*,uint32_t bufflen)
+		{
+			return STATIC_BINARY_LENGTH <= bufflen ? STATIC_BINARY_LENGTH : 0;
+		}
+	private:
+		mutable char _str[STATIC_BINARY_LENGTH + 1];
+	};
+
+	//zero-copy string views, parse_from_buffer makes them point into the input buffer,
+	//so the caller must keep the buffer alive while the view is used.
+	//the content of a view is not null terminated, use data() and size().
+	template<int len_size>
+	class variable_len_string_view
+	{
+	public:
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(len_size)> len_type;
+		static const int STATIC_BINARY_LENGTH = 0;
+	public:
+		variable_len_string_view()
+			:_data(""),_size(0)
+		{
+		}
+		variable_len_string_view(const char* str)
+			:_data(str),_size(strlen(str))
+		{
+			BINPROTO_ASSERT(_size <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+		}
+		variable_len_string_view(const char* str, uint32_t size)
+			:_data(str),_size(size)
+		{
+			BINPROTO_ASSERT(size <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+		}
+		variable_len_string_view(const std::string& str)
+			:_data(str.data()),_size(str.size())
+		{
+			BINPROTO_ASSERT(str.size() <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+		}
+		template<typename alloc_type>
+		variable_len_string_view(const variable_len_string<len_size,alloc_type>& str)
+			:_data(str.to_string().data()),_size(str.size())
+		{
+		}
+		variable_len_string_view(const variable_len_string_view& str)
+			:_data(str._data),_size(str._size)
+		{
+		}
+		variable_len_string_view& operator=(const variable_len_string_view& str)
+		{
+			_data = str._data;
+			_size = str._size;
+			return *this;
+		}
+		variable_len_string_view& assign(const char* str, uint32_t size)
+		{
+			BINPROTO_ASSERT(size <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"str len must not larger than len_size max value");
+			_data = str;
+			_size = size;
+			return *this;
+		}
+		std::string to_string() const
+		{
+			return std::string(_data,_size);
+		}
+		std::string trim() const
+		{
+			const char* zero = (const char*)memchr(_data,0,_size);
+			return std::string(_data,zero ? zero - _data : _size);
+		}
+		const char* data() const
+		{
+			return _data;
+		}
+		uint32_t size() const
+		{
+			return _size;
+		}
+		bool operator<(const variable_len_string_view& other) const
+		{
+			int ret = memcmp(_data,other._data,_size < other._size ? _size : other._size);
+			return ret < 0 || (ret == 0 && _size < other._size);
+		}
+		bool operator==(const variable_len_string_view& other) const
+		{
+			return _size == other._size && memcmp(_data,other._data,_size) == 0;
+		}
+		bool operator>(const variable_len_string_view& other) const
+		{
+			return other < *this;
+		}
+		bool operator!=(const variable_len_string_view& other) const
+		{
+			return !(*this == other);
+		}
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const 
+		{
+			BINPROTO_ASSERT(get_binary_len() <= bufflen,"variable_len_string_view serialize error");
+			uint32_t temp_len = 0;
+			temp_len+=len_type(_size).serialize_to_buffer(buffer,bufflen);
+			memcpy(buffer+temp_len,_data,_size);
+			temp_len += _size;
+			return temp_len;
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			if(_size <= _BINPROTO_SINK_INLINE_LEN)
+			{
+				uint32_t temp_len = get_binary_len();
+				serialize_to_buffer(sink.reserve(temp_len),temp_len);
+				sink.commit(temp_len);
+				return temp_len;
+			}
+			uint32_t temp_len = len_type(_size).serialize_to_sink(sink);
+			sink.write(_data,_size);
+			return temp_len + _size;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			uint32_t temp_len = 0;
+			len_type temp;
+			_BINPROTO_PARSE_ENSURE(bufflen >= temp.get_binary_len(),"variable_len_string_view parse error");
+			temp_len += temp.parse_from_buffer(buffer,bufflen);
+			_BINPROTO_PARSE_ENSURE(temp.to_int() <= bufflen - temp_len,"variable_len_string_view parse error");
+			_data = buffer + temp_len;
+			_size = temp.to_int();
+			temp_len += temp.to_int();
+			return temp_len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			uint32_t temp_len = validate_buffer(buffer,bufflen);
+			if(temp_len == 0)
+				return status.fail(parse_status::short_buffer);
+			_data = buffer + len_size;
+			_size = temp_len - len_size;
+			return temp_len;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return len_size + _size;
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			len_type temp;
+			_BINPROTO_PARSE_ENSURE(bufflen >= temp.get_binary_len(),"variable_len_string_view parse error");
+			uint32_t temp_len = temp.parse_from_buffer(buffer,bufflen);
+			_BINPROTO_PARSE_ENSURE(temp.to_int() <= bufflen - temp_len,"variable_len_string_view parse error");
+			return temp_len + temp.to_int();
+		}
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			len_type temp;
+			if(bufflen < temp.get_binary_len())
+				return 0;
+			uint32_t temp_len = temp.parse_from_buffer(buffer,bufflen);
+			if(temp.to_int() > bufflen - temp_len)
+				return 0;
+			return temp_len + temp.to_int();
+		}
+	private:
+		const char* _data;
+		uint32_t _size;
+	};
+
+	template<int str_len>
+	class fixed_len_string_view
+	{
+	public:
+		static const int STATIC_BINARY_LENGTH = str_len;
+	public:
+		//a default constructed view has no data and serializes as str_len zero bytes
+		fixed_len_string_view()
+			:_data(NULL)
+		{
+		}
+		//str must hold at least str_len bytes
+		explicit fixed_len_string_view(const char* str)
+			:_data(str)
+		{
+		}
+		fixed_len_string_view(const fixed_len_string<str_len>& str)
+			:_data(str.c_str())
+		{
+		}
+		fixed_len_string_view(const fixed_len_string_view& str)
+			:_data(str._data)
+		{
+		}
+		fixed_len_string_view& operator=(const fixed_len_string_view& str)
+		{
+			_data = str._data;
+			return *this;
+		}
+		std::string to_string() const
+		{
+			return _data ? std::string(_data,STATIC_BINARY_LENGTH) : std::string(STATIC_BINARY_LENGTH,'\0');
+		}
+		std::string trim() const
+		{
+			if(!_data)
+				return std::string();
+			const char* zero = (const char*)memchr(_data,0,STATIC_BINARY_LENGTH);
+			return std::string(_data,zero ? zero - _data : STATIC_BINARY_LENGTH);
+		}
+		const char* data() const
+		{
+			return _data;
+		}
+		uint32_t size() const
+		{
+			return STATIC_BINARY_LENGTH;
+		}
+		bool operator<(const fixed_len_string_view& other) const
+		{
+			return _compare(other) < 0;
+		}
+		bool operator==(const fixed_len_string_view& other) const
+		{
+			return _compare(other) == 0;
+		}
+		bool operator>(const fixed_len_string_view& other) const
+		{
+			return _compare(other) > 0;
+		}
+		bool operator!=(const fixed_len_string_view& other) const
+		{
+			return _compare(other) != 0;
+		}
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const 
+		{
+			BINPROTO_ASSERT(STATIC_BINARY_LENGTH <= bufflen,"fixed_len_string_view serialize error");
+			if(_data)
+				memcpy(buffer,_data,STATIC_BINARY_LENGTH);
+			else
+				memset(buffer,0,STATIC_BINARY_LENGTH);
+			return STATIC_BINARY_LENGTH;
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			serialize_to_buffer(sink.reserve(STATIC_BINARY_LENGTH),STATIC_BINARY_LENGTH);
+			sink.commit(STATIC_BINARY_LENGTH);
+			return STATIC_BINARY_LENGTH;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(STATIC_BINARY_LENGTH <= bufflen,"fixed_len_string_view parse error");
+			_data = buffer;
+			return STATIC_BINARY_LENGTH;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			if(STATIC_BINARY_LENGTH > bufflen)
+				return status.fail(parse_status::short_buffer);
+			return parse_from_buffer(buffer,bufflen);
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return STATIC_BINARY_LENGTH;
+		}
+		static uint32_t skip_from_buffer(const char*,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(STATIC_BINARY_LENGTH <= bufflen,"fixed_len_string_view parse error");
+			return STATIC_BINARY_LENGTH;
+		}
+		static uint32_t validate_buffer(const char*,uint32_t bufflen)
+		{
+			return STATIC_BINARY_LENGTH <= bufflen ? STATIC_BINARY_LENGTH : 0;
+		}
+	private:
+		int _compare(const fixed_len_string_view& other) const
+		{
+			if(_data && other._data)
+				return memcmp(_data,other._data,STATIC_BINARY_LENGTH);
+			return to_string().compare(other.to_string());
+		}
+	private:
+		const char* _data;
+	};
+
+	//lz77 block codec of compressed_blob, it trades ratio for speed like lz4.
+	//a block is a run of sequences, each is a token byte with the literal length in the high 4 bits
+	//and the match length - 4 in the low 4 bits, a 15 in either goes on in bytes added up to the first below 255,
+	//then the literals, then a 2 byte little endian match offset. the last sequence has literals only.
+	struct _lz_block
+	{
+		enum{MIN_MATCH = 4,HASH_BITS = 12,MAX_OFFSET = 65535,MAX_RATIO = 255};
+		//returns the block length, or 0 when the block would be longer than dstlen
+		static uint32_t compress(const char* src,uint32_t srclen,char* dst,uint32_t dstlen)
+		{
+			uint32_t table[1 << HASH_BITS];
+			memset(table,0,sizeof(table));
+			const char* ip = src;
+			const char* anchor = src;
+			const char* iend = src + srclen;
+			char* op = dst;
+			char* oend = dst + dstlen;
+			uint32_t misses = 0;
+			while(iend - ip > MIN_MATCH)
+			{
+				uint32_t seq = _read32(ip);
+				uint32_t hash = _hash(seq);
+				const char* ref = src + table[hash];
+				table[hash] = (uint32_t)(ip - src);
+				if(ref >= ip || ip - ref > MAX_OFFSET || _read32(ref) != seq)
+				{
+					//skip faster through data which does not compress
+					ip += 1 + (misses++ >> 5);
+					continue;
+				}
+				const char* mp = ip + MIN_MATCH;
+				const char* rp = ref + MIN_MATCH;
+				while(iend - mp >= 8 && _read64(mp) == _read64(rp))
+				{
+					mp += 8;
+					rp += 8;
+				}
+				while(mp < iend && *mp == *rp)
+				{
+					++mp;
+					++rp;
+				}
+				op = _write_sequence(op,oend,anchor,(uint32_t)(ip - anchor),(uint32_t)(ip - ref),(uint32_t)(mp - ip));
+				if(op == NULL)
+					return 0;
+				ip = mp;
+				anchor = ip;
+				misses = 0;
+			}
+			op = _write_sequence(op,oend,anchor,(uint32_t)(iend - anchor),0,0);
+			return op == NULL ? 0 : (uint32_t)(op - dst);
+		}
+		//dstlen is the exact decoded length, returns false on a malformed block
+		static bool decompress(const char* src,uint32_t srclen,char* dst,uint32_t dstlen)
+		{
+			const uint8_t* ip = (const uint8_t*)src;
+			const uint8_t* iend = ip + srclen;
+			char* op = dst;
+			char* oend = dst + dstlen;
+			for(;;)
+			{
+				if(ip == iend)
+					return false;
+				uint32_t token = *ip++;
+				uint32_t len = token >> 4;
+				if(len < 15 && iend - ip >= 16 && oend - op >= 16)
+				{
+					//short literals, copy a fixed 16 bytes and keep len of them
+					memcpy(op,ip,16);
+				}
+				else
+				{
+					if(len == 15 && !_read_len(ip,iend,dstlen,len))
+						return false;
+					if(len > (uint32_t)(iend - ip) || len > (uint32_t)(oend - op))
+						return false;
+					memcpy(op,ip,len);
+				}
+				op += len;
+				ip += len;
+				if(ip == iend)
+					return op == oend;
+				if(iend - ip < 2)
+					return false;
+				uint32_t offset = ip[0] | ((uint32_t)ip[1] << 8);
+				ip += 2;
+				if(offset == 0 || offset > (uint32_t)(op - dst))
+					return false;
+				len = token & 15;
+				if(len == 15 && !_read_len(ip,iend,dstlen,len))
+					return false;
+				len += MIN_MATCH;
+				if(len > (uint32_t)(oend - op))
+					return false;
+				const char* match = op - offset;
+				if(offset >= 16 && len <= 16 && oend - op >= 16)
+				{
+					memcpy(op,match,16);
+				}
+				else if(offset >= len)
+				{
+					memcpy(op,match,len);
+				}
+				else
+				{
+					//the match overlaps the output, which repeats the last offset bytes
+					uint32_t i = 0;
+					if(offset >= 8)
+					{
+						for(; i + 8 <= len; i += 8)
+							memcpy(op + i,match + i,8);
+					}
+					for(; i < len; i++)
+						op[i] = match[i];
+				}
+				op += len;
+			}
+		}
+		static uint32_t _read32(const char* p)
+		{
+			uint32_t v;
+			memcpy(&v,p,4);
+			return v;
+		}
+		static uint64_t _read64(const char* p)
+		{
+			uint64_t v;
+			memcpy(&v,p,8);
+			return v;
+		}
+		static uint32_t _hash(uint32_t v)
+		{
+			return (v * 2654435761U) >> (32 - HASH_BITS);
+		}
+		static char* _write_len(char* op,uint32_t len)
+		{
+			for(; len >= 255; len -= 255)
+				*op++ = (char)255;
+			*op++ = (char)len;
+			return op;
+		}
+		static char* _write_sequence(char* op,char* oend,const char* literals,uint32_t literal_len,uint32_t offset,uint32_t match_len)
+		{
+			if((uint64_t)(oend - op) < 1 + (uint64_t)literal_len + literal_len / 255 + 1 + 2 + match_len / 255 + 1)
+				return NULL;
+			uint32_t match_code = match_len ? match_len - MIN_MATCH : 0;
+			*op++ = (char)(((literal_len < 15 ? literal_len : 15) << 4) | (match_code < 15 ? match_code : 15));
+			if(literal_len >= 15)
+				op = _write_len(op,literal_len - 15);
+			memcpy(op,literals,literal_len);
+			op += literal_len;
+			if(match_len == 0)
+				return op;
+			*op++ = (char)(offset & 0xFF);
+			*op++ = (char)(offset >> 8);
+			if(match_code >= 15)
+				op = _write_len(op,match_code - 15);
+			return op;
+		}
+		static bool _read_len(const uint8_t*& ip,const uint8_t* iend,uint32_t limit,uint32_t& len)
+		{
+			uint32_t b;
+			do
+			{
+				if(ip == iend || len > limit)
+					return false;
+				b = *ip++;
+				len += b;
+			}while(b == 255);
+			return true;
+		}
+	};
+
+	//a byte string which is lz compressed on the wire, for large text-like payloads such as logs or json.
+	//the encoding is a len_size length of what follows, a method byte, 0 for raw bytes and 1 for compressed,
+	//and for compressed a len_size decoded length, so the decoder allocates once, then the _lz_block.
+	//it is stored raw when it is short or compression saves less than 1/16 of it.
+	//the encoded bytes are kept after serialize, get_binary_len and serialize compress only once.
+	template<int len_size, typename alloc_type = BINPROTO_DEFAULT_ALLOCATOR(char) >
+	class compressed_blob
+	{
+	public:
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(len_size)> len_type;
+		typedef std::basic_string<char,std::char_traits<char>,alloc_type> string_type;
+		static const int STATIC_BINARY_LENGTH = 0;
+		enum{MIN_COMPRESS_LEN = 64,METHOD_RAW = 0,METHOD_LZ = 1};
+	public:
+		compressed_blob()
+			:_packed_valid(false)
+		{
+		}
+		explicit compressed_blob(const alloc_type& alloc)
+			:_str(alloc),_packed(alloc),_packed_valid(false)
+		{
+		}
+		compressed_blob(const char* str, uint32_t size)
+			:_packed_valid(false)
+		{
+			assign(str,size);
+		}
+		compressed_blob(const std::string& str)
+			:_packed_valid(false)
+		{
+			assign(str.data(),str.size());
+		}
+		compressed_blob& operator=(const std::string& str)
+		{
+			return assign(str.data(),str.size());
+		}
+		compressed_blob& assign(const char* str, uint32_t size)
+		{
+			BINPROTO_ASSERT(size < BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"blob len must be less than len_size max value");
+			_str.assign(str,size);
+			_packed_valid = false;
+			return *this;
+		}
+		const string_type& to_string() const
+		{
+			return _str;
+		}
+		const char* data() const
+		{
+			return _str.data();
+		}
+		uint32_t size() const
+		{
+			return _str.size();
+		}
+		bool compressed() const
+		{
+			_pack();
+			return !_packed.empty();
+		}
+		bool operator==(const compressed_blob& other) const
+		{
+			return _str == other._str;
+		}
+		bool operator!=(const compressed_blob& other) const
+		{
+			return _str != other._str;
+		}
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const
+		{
+			BINPROTO_ASSERT(get_binary_len() <= bufflen,"compressed_blob serialize error");
+			uint32_t temp_len = len_type(_payload_len()).serialize_to_buffer(buffer,bufflen);
+			if(!_packed.empty())
+			{
+				memcpy(buffer + temp_len,_packed.data(),_packed.size());
+				return temp_len + _packed.size();
+			}
+			buffer[temp_len++] = METHOD_RAW;
+			memcpy(buffer + temp_len,_str.data(),_str.size());
+			return temp_len + _str.size();
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			uint32_t temp_len = len_type(_payload_len()).serialize_to_sink(sink);
+			if(!_packed.empty())
+			{
+				sink.write(_packed.data(),_packed.size());
+				return temp_len + _packed.size();
+			}
+			*sink.reserve(1) = METHOD_RAW;
+			sink.commit(1);
+			sink.write(_str.data(),_str.size());
+			return temp_len + 1 + _str.size();
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			uint32_t temp_len = validate_buffer(buffer,bufflen);
+			_BINPROTO_PARSE_ENSURE(temp_len != 0 && _unpack(buffer + len_size,temp_len - len_size),"compressed_blob parse error");
+			return temp_len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			len_type temp;
+			if(bufflen < len_size)
+				return status.fail(parse_status::short_buffer);
+			temp.parse_from_buffer(buffer,bufflen);
+			if(temp.to_int() > bufflen - len_size)
+				return status.fail(parse_status::short_buffer);
+			if(validate_buffer(buffer,bufflen) == 0 || !_unpack(buffer + len_size,temp.to_int()))
+				return status.fail(parse_status::invalid_data);
+			return len_size + temp.to_int();
+		}
+		//the encoded bytes are gathered in _packed and decoded once whole, a malformed blob is left empty.
+		//_packed is no cache of _str while it gathers, and is emptied after, so serialize packs _str again.
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			if(cursor.at(depth).step == 0)
+			{
+				len_type temp;
+				if(!temp.parse_some(buffer,bufflen,cursor,depth + 1))
+					return false;
+				cursor.reset(depth + 1);
+				//no buffer holds a length past 32 bits
+				if(temp.to_int() > UINT32_MAX)
+					return cursor.fail();
+				parse_cursor::frame& frame = cursor.at(depth);
+				frame.step = 1;
+				frame.count = temp.to_int();
+				_packed_valid = false;
+				_packed.clear();
+				_packed.reserve(temp.to_int() < bufflen ? temp.to_int() : bufflen);
+			}
+			uint64_t left = cursor.at(depth).count - _packed.size();
+			uint32_t n = left < bufflen ? (uint32_t)left : bufflen;
+			_packed.append(buffer,n);
+			buffer += n;
+			bufflen -= n;
+			if(_packed.size() != cursor.at(depth).count)
+				return false;
+			bool valid = _valid_payload(_packed.data(),_packed.size()) && _unpack(_packed.data(),_packed.size());
+			_packed.clear();
+			if(!valid)
+			{
+				_str.clear();
+				return cursor.fail();
+			}
+			return true;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return len_size + _payload_len();
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			len_type temp;
+			_BINPROTO_PARSE_ENSURE(bufflen >= len_size,"compressed_blob parse error");
+			temp.parse_from_buffer(buffer,bufflen);
+			_BINPROTO_PARSE_ENSURE(temp.to_int() <= bufflen - len_size,"compressed_blob parse error");
+			return len_size + temp.to_int();
+		}
+		//checks the framing and the decoded length, the block itself is checked while it is decoded
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			len_type temp;
+			if(bufflen < len_size)
+				return 0;
+			temp.parse_from_buffer(buffer,bufflen);
+			if(temp.to_int() > bufflen - len_size || !_valid_payload(buffer + len_size,temp.to_int()))
+				return 0;
+			return len_size + temp.to_int();
+		}
+	private:
+		uint32_t _payload_len() const
+		{
+			_pack();
+			return _packed.empty() ? 1 + _str.size() : _packed.size();
+		}
+		//an empty _packed means the blob goes raw
+		void _pack() const
+		{
+			if(_packed_valid)
+				return;
+			_packed_valid = true;
+			_packed.clear();
+			if(_str.size() < MIN_COMPRESS_LEN)
+				return;
+			uint32_t head = 1 + len_size;
+			uint32_t limit = _str.size() - _str.size() / 16 - head;
+			_packed.resize(head + limit);
+			uint32_t block_len = _lz_block::compress(_str.data(),_str.size(),&_packed[head],limit);
+			if(block_len == 0)
+			{
+				_packed.clear();
+				return;
+			}
+			_packed[0] = METHOD_LZ;
+			len_type(_str.size()).serialize_to_buffer(&_packed[1],len_size);
+			_packed.resize(head + block_len);
+		}
+		//a decoded length beyond what the block can expand to is refused before allocating
+		static bool _valid_payload(const char* payload,uint32_t len)
+		{
+			if(len < 1)
+				return false;
+			if(payload[0] == METHOD_RAW)
+				return true;
+			if(payload[0] != METHOD_LZ || len < 1 + len_size)
+				return false;
+			len_type raw_len;
+			raw_len.parse_from_buffer(payload + 1,len_size);
+			return (uint64_t)raw_len.to_int() <= (uint64_t)(len - 1 - len_size) * _lz_block::MAX_RATIO;
+		}
+		bool _unpack(const char* payload,uint32_t len)
+		{
+			_packed_valid = false;
+			if(payload[0] == METHOD_RAW)
+			{
+				_str.assign(payload + 1,len - 1);
+				return true;
+			}
+			len_type raw_len;
+			raw_len.parse_from_buffer(payload + 1,len_size);
+			_str.resize(raw_len.to_int());
+			if(_str.empty() || !_lz_block::decompress(payload + 1 + len_size,len - 1 - len_size,&_str[0],_str.size()))
+			{
+				_str.clear();
+				return false;
+			}
+			return true;
+		}
+	private:
+		string_type _str;
+		mutable string_type _packed;
+		mutable bool _packed_valid;
+	};
+
+	template<typename obj_type, int list_len_size, typename alloc_type = BINPROTO_DEFAULT_ALLOCATOR(obj_type) >
+	class binary_obj_list
+	{
+	public:
+		BINPROTO_STATIC_ASSERT((_binproto_is_binproto_obj<obj_type>::value),"binary_obj_list obj type must be a binproto object type");
+	public:
+		static const int STATIC_BINARY_LENGTH = 0;
+		static const int list_size_len = list_len_size;
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(list_len_size)> list_size_type;
+	public:
+		typedef std::vector<obj_type,alloc_type> container;
+		typedef typename container::iterator iterator;
+		typedef typename container::const_iterator const_iterator;
+		typedef typename container::reverse_iterator reverse_iterator;
+		typedef typename container::const_reverse_iterator const_reverse_iterator;
+	public:
+		binary_obj_list():_array()
+		{
+		}
+		explicit binary_obj_list(const alloc_type& alloc):_array(alloc)
+		{
+		}
+		binary_obj_list(const binary_obj_list& other)
+			:_array(other._array)
+		{
+		}
+		iterator begin()
+		{
+			return _array.begin();
+		}
+		iterator end()
+		{
+			return _array.end();
+		}
+		const_iterator begin() const
+		{
+			return _array.begin();
+		}
+		const_iterator end() const
+		{
+			return _array.end();
+		}
+		reverse_iterator rbegin()
+		{
+			return _array.rbegin();
+		}
+		reverse_iterator rend()
+		{
+			return _array.rend();
+		}
+		const_reverse_iterator rbegin() const
+		{
+			return _array.rbegin();
+		}
+		const_reverse_iterator rend() const
+		{
+			return _array.rend();
+		}
+		void push_back(const obj_type& _Val)
+		{
+			_array.push_back(_Val);
+			BINPROTO_ASSERT(_array.size() <= BINPROTO_UINT_MAX_VALUE(typename list_size_type::uint_type),"list size must not larger than list_size_type max value");
+		}
+		void pop_back()
+		{
+			_array.pop_back();
+		}
+		iterator erase(iterator _Where)
+		{
+			return _array.erase(_Where);
+		}
+		iterator erase(iterator _First_arg, iterator _Last_arg)
+		{
+			return _array.erase(_First_arg,_Last_arg);
+		}
+		obj_type& front()
+		{
+			return _array.front();
+		}
+		obj_type& back()
+		{
+			return _array.back();
+		}
+		const obj_type&  front() const
+		{
+			return _array.front();
+		}
+		const obj_type&  back() const
+		{
+			return _array.back();
+		}
+		obj_type& operator[](uint32_t _Pos)
+		{
+			return _array[_Pos];
+		}
+		const obj_type& operator[](uint32_t _Pos) const
+		{
+			return _array[_Pos];
+		}
+		iterator insert(iterator _Where, const obj_type& _Val)
+		{
+			iterator it = _array.insert(_Where,_Val);
+			BINPROTO_ASSERT(_array.size() <= BINPROTO_UINT_MAX_VALUE(typename list_size_type::uint_type),"list size must not larger than list_size_type max value");
+			return it;
+		}
+		uint32_t size() const
+		{
+			return _array.size();
+		}
+		void clear()
+		{
+			_array.clear();
+		}
+		binary_obj_list& operator=(const binary_obj_list& other)
+		{
+			_array = other._array;
+			return *this;
+		}
+		void swap(binary_obj_list& other)
+		{
+			_array.swap(other._array);
+		}
+		list_size_type get_size_obj() const
+		{
+			return list_size_type(size());
+		}
+	public:
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const 
+		{
+			uint32_t temp_len = 0;
+			BINPROTO_ASSERT(list_len_size <= bufflen,"binary_obj_list length serialize error");
+			temp_len += get_size_obj().serialize_to_buffer(buffer, bufflen);
+			uint32_t s = size();
+			if(obj_type::STATIC_BINARY_LENGTH != 0 && s != 0)
+			{
+				BINPROTO_ASSERT((uint64_t)obj_type::STATIC_BINARY_LENGTH * s <= bufflen - temp_len,"binary_obj_list serialize error");
+				_serialize_static_elements(buffer + temp_len,s,_bulk_tag());
+				return temp_len + obj_type::STATIC_BINARY_LENGTH * s;
+			}
+			for(uint32_t i = 0; i < s; i++)
+			{
+				temp_len += _array[i].serialize_to_buffer(buffer+temp_len, bufflen-temp_len);
+			}
+			return temp_len;
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			uint32_t temp_len = get_size_obj().serialize_to_sink(sink);
+			uint32_t s = size();
+			if(obj_type::STATIC_BINARY_LENGTH != 0 && s != 0)
+			{
+				uint32_t list_len = obj_type::STATIC_BINARY_LENGTH * s;
+				_serialize_static_elements(sink.reserve(list_len),s,_bulk_tag());
+				sink.commit(list_len);
+				return temp_len + list_len;
+			}
+			for(uint32_t i = 0; i < s; i++)
+			{
+				temp_len += _array[i].serialize_to_sink(sink);
+			}
+			return temp_len;
+		}
+		//parsing reuses the elements already in the list, every element parse overwrites the whole element,
+		//so strings keep their capacity and parsing a recurring message shape again does not allocate.
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			uint32_t temp_len = 0;
+			list_size_type temp;
+			_BINPROTO_PARSE_ENSURE(list_len_size <= bufflen,"binary_obj_list length parse error");
+			temp_len += temp.parse_from_buffer(buffer, bufflen);
+
+			_BINPROTO_PARSE_TRY;
+			_BINPROTO_PARSE_ENSURE(_count_fits(temp.to_int(),bufflen - temp_len),"binary_obj_list parse error");
+			//lists of static objects are checked once, numeric lists are then byte swapped in one run
+			if(obj_type::STATIC_BINARY_LENGTH != 0 && temp.to_int() != 0)
+			{
+				uint64_t list_len = (uint64_t)obj_type::STATIC_BINARY_LENGTH * temp.to_int();
+				_array.resize(temp.to_int());
+				_parse_static_elements(buffer + temp_len,temp.to_int(),_bulk_tag());
+				return temp_len + (uint32_t)list_len;
+			}
+			_array.resize(temp.to_int());
+			if(_is_varint_obj<obj_type>::value && temp.to_int() != 0)
+			{
+				uint32_t run_len = _parse_varint_run(buffer + temp_len,bufflen - temp_len,_varint_tag());
+				if(run_len != 0)
+					return temp_len + run_len;
+				//malformed, the element loop finds the bad varint
+			}
+			for(uint64_t i = 0; i < temp.to_int(); i++)
+			{
+				temp_len += _array[i].parse_from_buffer(buffer + temp_len, bufflen - temp_len);
+			}
+			return temp_len;
+			_BINPROTO_PARSE_CATCH("binary_obj_list");
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			list_size_type temp;
+			uint32_t temp_len = temp.parse_from_buffer(buffer, bufflen, status);
+			if(!status.ok())
+				return 0;
+			if(!_count_fits(temp.to_int(),bufflen - temp_len))
+				return status.fail(parse_status::short_buffer);
+
+			_array.resize(temp.to_int());
+			if(obj_type::STATIC_BINARY_LENGTH != 0 && temp.to_int() != 0)
+			{
+				_parse_static_elements(buffer + temp_len,temp.to_int(),_bulk_tag());
+				return temp_len + obj_type::STATIC_BINARY_LENGTH * temp.to_int();
+			}
+			if(_is_varint_obj<obj_type>::value && temp.to_int() != 0)
+			{
+				uint32_t run_len = _parse_varint_run(buffer + temp_len,bufflen - temp_len,_varint_tag());
+				if(run_len != 0)
+					return temp_len + run_len;
+			}
+			for(uint32_t i = 0; i < temp.to_int(); i++)
+			{
+				uint32_t obj_len = _array[i].parse_from_buffer(buffer + temp_len, bufflen - temp_len, status);
+				if(!status.ok())
+					return status.fail_at(temp_len);
+				temp_len += obj_len;
+			}
+			return temp_len;
+		}
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			if(cursor.at(depth).step == 0)
+			{
+				list_size_type temp;
+				if(!temp.parse_some(buffer,bufflen,cursor,depth + 1))
+					return false;
+				cursor.reset(depth + 1);
+				parse_cursor::frame& frame = cursor.at(depth);
+				//the element index of the frame is 32 bits
+				if(temp.to_int() > UINT32_MAX)
+					return cursor.fail();
+				frame.step = 1;
+				frame.count = temp.to_int();
+				//elements are reused, and added only as their bytes arrive
+				if(temp.to_int() < _array.size())
+					_array.resize(temp.to_int());
+			}
+			while(cursor.at(depth).index < cursor.at(depth).count)
+			{
+				if(_parse_some_bulk(buffer,bufflen,cursor,depth,_bulk_tag()))
+					continue;
+				if(cursor.at(depth).index == _array.size())
+					_array.resize(_array.size() + 1);
+				if(!_array[cursor.at(depth).index].parse_some(buffer,bufflen,cursor,depth + 1))
+					return false;
+				cursor.reset(depth + 1);
+				++cursor.at(depth).index;
+			}
+			return true;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return _get_binary_len_is_static(typename _binproto_bool_value_to_bool_type<obj_type::STATIC_BINARY_LENGTH != 0>::type());
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			uint32_t temp_len = 0;
+			list_size_type temp;
+			_BINPROTO_PARSE_ENSURE(list_len_size <= bufflen,"binary_obj_list length parse error");
+			temp_len += temp.parse_from_buffer(buffer, bufflen);
+			_BINPROTO_PARSE_ENSURE(_count_fits(temp.to_int(),bufflen - temp_len),"binary_obj_list parse error");
+			if(obj_type::STATIC_BINARY_LENGTH != 0)
+				return temp_len + obj_type::STATIC_BINARY_LENGTH * (uint32_t)temp.to_int();
+
+			_BINPROTO_PARSE_TRY;
+			for(uint64_t i = 0; i < temp.to_int(); i++)
+			{
+				temp_len += obj_type::skip_from_buffer(buffer + temp_len, bufflen - temp_len);
+			}
+			return temp_len;
+			_BINPROTO_PARSE_CATCH("binary_obj_list");
+		}
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			list_size_type temp;
+			if(bufflen < list_len_size)
+				return 0;
+			uint32_t temp_len = temp.parse_from_buffer(buffer, bufflen);
+			if(!_count_fits(temp.to_int(),bufflen - temp_len))
+				return 0;
+			if(obj_type::STATIC_BINARY_LENGTH != 0)
+				return temp_len + obj_type::STATIC_BINARY_LENGTH * (uint32_t)temp.to_int();
+			for(uint32_t i = 0; i < temp.to_int(); i++)
+			{
+				uint32_t obj_len = obj_type::validate_buffer(buffer + temp_len, bufflen - temp_len);
+				if(obj_len == 0)
+					return 0;
+				temp_len += obj_len;
+			}
+			return temp_len;
+		}
+	public:
+		//read-only lazy view of an encoded list, elements are decoded by operator[] only,
+		//offsets of dynamic elements are found by skipping and the last position is cached,
+		//so iterating the view in order is linear.
+		class view
+		{
+		public:
+			typedef typename _binproto_view_traits<obj_type>::type element_type;
+		public:
+			view()
+				:_buffer(NULL),_bufflen(0),_size(0),_cursor_index(0),_cursor_offset(list_len_size)
+			{
+			}
+			view(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+				:_buffer(buffer),_bufflen(bufflen),_size(0),_cursor_index(0),_cursor_offset(list_len_size)
+			{
+				list_size_type temp;
+				_BINPROTO_PARSE_ENSURE(list_len_size <= bufflen,"binary_obj_list length parse error");
+				temp.parse_from_buffer(buffer, bufflen);
+				_BINPROTO_PARSE_ENSURE(temp.to_int() <= UINT32_MAX,"binary_obj_list view error");
+				_size = temp.to_int();
+			}
+			uint32_t size() const
+			{
+				return _size;
+			}
+			element_type operator[](uint32_t index) const BINPROTO_THROW_SPEC
+			{
+				BINPROTO_ASSERT(index < _size,"binary_obj_list view index out of range");
+				uint32_t offset = _element_offset(index);
+				return _binproto_view_traits<obj_type>::make(_buffer + offset, _bufflen - offset);
+			}
+			uint32_t get_binary_len() const BINPROTO_THROW_SPEC
+			{
+				return _element_offset(_size);
+			}
+		private:
+			uint32_t _element_offset(uint32_t index) const BINPROTO_THROW_SPEC
+			{
+				if(obj_type::STATIC_BINARY_LENGTH != 0)
+				{
+					uint64_t offset = list_len_size + (uint64_t)obj_type::STATIC_BINARY_LENGTH * index;
+					_BINPROTO_PARSE_ENSURE(offset <= _bufflen,"binary_obj_list view error");
+					return (uint32_t)offset;
+				}
+				if(index < _cursor_index)
+				{
+					_cursor_index = 0;
+					_cursor_offset = list_len_size;
+				}
+				while(_cursor_index < index)
+				{
+					_cursor_offset += obj_type::skip_from_buffer(_buffer + _cursor_offset, _bufflen - _cursor_offset);
+					++_cursor_index;
+				}
+				return _cursor_offset;
+			}
+		private:
+			const char* _buffer;
+			uint32_t _bufflen;
+			uint32_t _size;
+			mutable uint32_t _cursor_index;
+			mutable uint32_t _cursor_offset;
+		};
+	private:
+		//an element takes at least one byte, so a count beyond the rest of the buffer is rejected before the list is sized,
+		//a list of packets without fields included, 8 byte counts are checked before the product can wrap
+		static bool _count_fits(uint64_t count,uint32_t bufflen)
+		{
+			uint64_t min_len = obj_type::STATIC_BINARY_LENGTH != 0 ? obj_type::STATIC_BINARY_LENGTH : 1;
+			return count <= bufflen && min_len * count <= bufflen;
+		}
+		typedef typename _binproto_bool_value_to_bool_type<_is_num_obj<obj_type>::value>::type _bulk_tag;
+		static void _bulk_copy(const char* src,char* dst,uint32_t n,_binproto_true)
+		{
+			if(obj_type::byte_order::need_swap)
+				_bulk_byteswap<obj_type::STATIC_BINARY_LENGTH>::run(src,dst,n);
+			else
+				memcpy(dst,src,(size_t)n * obj_type::STATIC_BINARY_LENGTH);
+		}
+		static void _bulk_copy(const char*,char*,uint32_t,_binproto_false)
+		{
+		}
+		//the length of the run is checked by the caller
+		void _parse_static_elements(const char* buffer,uint32_t n,_binproto_true)
+		{
+			_bulk_copy(buffer,(char*)&_array[0],n,_bulk_tag());
+		}
+		void _parse_static_elements(const char* buffer,uint32_t n,_binproto_false)
+		{
+			for(uint32_t i = 0; i < n; i++)
+			{
+				_array[i].parse_from_buffer(buffer + i * obj_type::STATIC_BINARY_LENGTH, obj_type::STATIC_BINARY_LENGTH);
+			}
+		}
+		void _serialize_static_elements(char* buffer,uint32_t n,_binproto_true) const
+		{
+			_bulk_copy((const char*)&_array[0],buffer,n,_bulk_tag());
+		}
+		void _serialize_static_elements(char* buffer,uint32_t n,_binproto_false) const
+		{
+			for(uint32_t i = 0; i < n; i++)
+			{
+				_array[i].serialize_to_buffer(buffer + i * obj_type::STATIC_BINARY_LENGTH, obj_type::STATIC_BINARY_LENGTH);
+			}
+		}
+		//takes all whole numbers of the chunk at once, a number split across chunks goes through parse_some
+		bool _parse_some_bulk(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth,_binproto_true)
+		{
+			if(cursor.at(depth + 1).partial_len != 0 || bufflen < obj_type::STATIC_BINARY_LENGTH)
+				return false;
+			parse_cursor::frame& frame = cursor.at(depth);
+			uint32_t n = frame.count - frame.index;
+			n = n < bufflen / obj_type::STATIC_BINARY_LENGTH ? n : bufflen / obj_type::STATIC_BINARY_LENGTH;
+			if(_array.size() < frame.index + n)
+				_array.resize(frame.index + n);
+			_bulk_copy(buffer,(char*)&_array[frame.index],n,_bulk_tag());
+			frame.index += n;
+			buffer += n * obj_type::STATIC_BINARY_LENGTH;
+			bufflen -= n * obj_type::STATIC_BINARY_LENGTH;
+			return true;
+		}
+		bool _parse_some_bulk(const char*&,uint32_t&,parse_cursor&,uint32_t,_binproto_false)
+		{
+			return false;
+		}
+		typedef typename _binproto_bool_value_to_bool_type<_is_varint_obj<obj_type>::value>::type _varint_tag;
+		uint32_t _parse_varint_run(const char* buffer,uint32_t bufflen,_binproto_true)
+		{
+			return _varint<typename obj_type::wire_type>::decode_run(buffer,bufflen,&_array[0],_array.size());
+		}
+		uint32_t _parse_varint_run(const char*,uint32_t,_binproto_false)
+		{
+			return 0;
+		}
+		uint32_t _get_binary_len_is_static(_binproto_true) const
+		{
+			size_t iLength = list_size_type::STATIC_BINARY_LENGTH;
+			iLength += obj_type::STATIC_BINARY_LENGTH * size();
+			return iLength;
+		}
+		uint32_t _get_binary_len_is_static(_binproto_false) const
+		{
+			size_t iLength = list_size_type::STATIC_BINARY_LENGTH;
+
+			uint32_t s = size();
+			for(uint32_t i = 0; i < s; i++)
+			{
+				iLength += _array[i].get_binary_len();
+			}
+
+			return iLength;
+		}
+	private:
+		container _array;
+	};
+
+	//list of few distinct values repeated many times, such as status strings or names.
+	//each distinct value is encoded once in a dictionary, a binary_obj_list, followed by a list_len_size count
+	//and one code per element, of 1 byte for up to 256 dictionary entries, 2 bytes up to 65536 and 4 bytes above.
+	//operator[] returns a reference into the dictionary, so parsing copies each distinct value only once.
+	//obj_type must have operator<, push_back looks values up in a map which is rebuilt when adding after a parse.
+	template<typename obj_type, int list_len_size, typename alloc_type = BINPROTO_DEFAULT_ALLOCATOR(obj_type) >
+	class dict_obj_list
+	{
+	public:
+		BINPROTO_STATIC_ASSERT((_binproto_is_binproto_obj<obj_type>::value),"dict_obj_list obj type must be a binproto object type");
+	public:
+		static const int STATIC_BINARY_LENGTH = 0;
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(list_len_size)> list_size_type;
+		typedef binary_obj_list<obj_type,list_len_size,alloc_type> dictionary_type;
+	public:
+		dict_obj_list()
+			:_index_valid(true)
+		{
+		}
+		explicit dict_obj_list(const alloc_type& alloc)
+			:_dict(alloc),_index_valid(true)
+		{
+		}
+		uint32_t size() const
+		{
+			return _codes.size();
+		}
+		bool empty() const
+		{
+			return _codes.empty();
+		}
+		const obj_type& operator[](uint32_t index) const
+		{
+			BINPROTO_ASSERT(index < _codes.size(),"dict_obj_list index out of range");
+			return _dict[_codes[index]];
+		}
+		//index of the element value in dictionary()
+		uint32_t code(uint32_t index) const
+		{
+			BINPROTO_ASSERT(index < _codes.size(),"dict_obj_list index out of range");
+			return _codes[index];
+		}
+		const dictionary_type& dictionary() const
+		{
+			return _dict;
+		}
+		void push_back(const obj_type& obj)
+		{
+			BINPROTO_ASSERT(_codes.size() < BINPROTO_UINT_MAX_VALUE(typename list_size_type::uint_type),"dict_obj_list is full");
+			if(!_index_valid)
+				_rebuild_index();
+			std::pair<typename index_type::iterator,bool> result = _index.insert(std::make_pair(obj,(uint32_t)_dict.size()));
+			if(result.second)
+				_dict.push_back(obj);
+			_codes.push_back(result.first->second);
+		}
+		void clear()
+		{
+			_dict.clear();
+			_codes.clear();
+			_index.clear();
+			_index_valid = true;
+		}
+		bool operator==(const dict_obj_list& other) const
+		{
+			if(size() != other.size())
+				return false;
+			for(uint32_t i = 0; i < size(); i++)
+			{
+				if(!((*this)[i] == other[i]))
+					return false;
+			}
+			return true;
+		}
+		bool operator!=(const dict_obj_list& other) const
+		{
+			return !(*this == other);
+		}
+	public:
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const
+		{
+			uint32_t temp_len = _dict.serialize_to_buffer(buffer,bufflen);
+			uint32_t code_size = _code_size(_dict.size());
+			BINPROTO_ASSERT(list_len_size + (uint64_t)code_size * size() <= bufflen - temp_len,"dict_obj_list serialize error");
+			temp_len += list_size_type(size()).serialize_to_buffer(buffer + temp_len,bufflen - temp_len);
+			_encode_codes(buffer + temp_len,code_size);
+			return temp_len + code_size * size();
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			uint32_t temp_len = _dict.serialize_to_sink(sink);
+			temp_len += list_size_type(size()).serialize_to_sink(sink);
+			uint32_t codes_len = _code_size(_dict.size()) * size();
+			if(codes_len != 0)
+			{
+				_encode_codes(sink.reserve(codes_len),_code_size(_dict.size()));
+				sink.commit(codes_len);
+			}
+			return temp_len + codes_len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_TRY;
+			uint32_t temp_len = _dict.parse_from_buffer(buffer,bufflen);
+			list_size_type temp;
+			_BINPROTO_PARSE_ENSURE(list_len_size <= bufflen - temp_len,"dict_obj_list length parse error");
+			temp_len += temp.parse_from_buffer(buffer + temp_len,bufflen - temp_len);
+			uint32_t code_size = _code_size(_dict.size());
+			_BINPROTO_PARSE_ENSURE(_codes_fit(temp.to_int(),code_size,bufflen - temp_len),"dict_obj_list parse error");
+			_index_valid = false;
+			_codes.resize(temp.to_int());
+			bool in_range = _decode_codes(buffer + temp_len,0,temp.to_int(),code_size);
+			if(!in_range)
+				_codes.clear();
+			_BINPROTO_PARSE_ENSURE(in_range,"dict_obj_list code out of range");
+			return temp_len + code_size * temp.to_int();
+			_BINPROTO_PARSE_CATCH("dict_obj_list");
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			uint32_t temp_len = _dict.parse_from_buffer(buffer,bufflen,status);
+			if(!status.ok())
+				return 0;
+			list_size_type temp;
+			uint32_t len = temp.parse_from_buffer(buffer + temp_len,bufflen - temp_len,status);
+			if(!status.ok())
+				return status.fail_at(temp_len);
+			temp_len += len;
+			uint32_t code_size = _code_size(_dict.size());
+			if(!_codes_fit(temp.to_int(),code_size,bufflen - temp_len))
+			{
+				status.fail(parse_status::short_buffer);
+				return status.fail_at(temp_len);
+			}
+			_index_valid = false;
+			_codes.resize(temp.to_int());
+			if(!_decode_codes(buffer + temp_len,0,temp.to_int(),code_size))
+			{
+				_codes.clear();
+				status.fail(parse_status::invalid_data);
+				return status.fail_at(temp_len);
+			}
+			return temp_len + code_size * temp.to_int();
+		}
+		//a code out of range fails the cursor and leaves the list empty
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			if(cursor.at(depth).step == 0)
+			{
+				if(!_dict.parse_some(buffer,bufflen,cursor,depth + 1))
+					return false;
+				cursor.reset(depth + 1);
+				cursor.at(depth).step = 1;
+			}
+			if(cursor.at(depth).step == 1)
+			{
+				list_size_type temp;
+				if(!temp.parse_some(buffer,bufflen,cursor,depth + 1))
+					return false;
+				cursor.reset(depth + 1);
+				//the code index of the frame is 32 bits
+				if(temp.to_int() > UINT32_MAX)
+				{
+					_codes.clear();
+					return cursor.fail();
+				}
+				parse_cursor::frame& frame = cursor.at(depth);
+				frame.step = 2;
+				frame.count = temp.to_int();
+				_index_valid = false;
+				_codes.clear();
+			}
+			parse_cursor::frame& frame = cursor.at(depth);
+			uint32_t code_size = _code_size(_dict.size());
+			while(frame.index < frame.count)
+			{
+				if(frame.partial_len == 0 && bufflen >= code_size)
+				{
+					//all whole codes of the chunk at once
+					uint32_t n = bufflen / code_size;
+					n = n < frame.count - frame.index ? n : (uint32_t)(frame.count - frame.index);
+					_codes.resize(frame.index + n);
+					if(!_decode_codes(buffer,frame.index,n,code_size))
+					{
+						_codes.clear();
+						return cursor.fail();
+					}
+					frame.index += n;
+					buffer += n * code_size;
+					bufflen -= n * code_size;
+					continue;
+				}
+				if(bufflen == 0)
+					return false;
+				frame.partial[frame.partial_len++] = *buffer++;
+				--bufflen;
+				if(frame.partial_len == code_size)
+				{
+					_codes.resize(frame.index + 1);
+					if(!_decode_codes(frame.partial,frame.index,1,code_size))
+					{
+						_codes.clear();
+						return cursor.fail();
+					}
+					frame.partial_len = 0;
+					++frame.index;
+				}
+			}
+			return true;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return _dict.get_binary_len() + list_len_size + _code_size(_dict.size()) * size();
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_TRY;
+			list_size_type dict_size;
+			_BINPROTO_PARSE_ENSURE(list_len_size <= bufflen,"dict_obj_list length parse error");
+			dict_size.parse_from_buffer(buffer,bufflen);
+			uint32_t temp_len = dictionary_type::skip_from_buffer(buffer,bufflen);
+			list_size_type temp;
+			_BINPROTO_PARSE_ENSURE(list_len_size <= bufflen - temp_len,"dict_obj_list length parse error");
+			temp_len += temp.parse_from_buffer(buffer + temp_len,bufflen - temp_len);
+			uint64_t codes_len = (uint64_t)_code_size(dict_size.to_int()) * temp.to_int();
+			_BINPROTO_PARSE_ENSURE(codes_len <= bufflen - temp_len,"dict_obj_list parse error");
+			return temp_len + (uint32_t)codes_len;
+			_BINPROTO_PARSE_CATCH("dict_obj_list");
+		}
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			uint32_t temp_len = dictionary_type::validate_buffer(buffer,bufflen);
+			if(temp_len == 0 || list_len_size > bufflen - temp_len)
+				return 0;
+			list_size_type dict_size;
+			dict_size.parse_from_buffer(buffer,bufflen);
+			list_size_type temp;
+			temp_len += temp.parse_from_buffer(buffer + temp_len,bufflen - temp_len);
+			uint32_t code_size = _code_size(dict_size.to_int());
+			if(!_codes_fit(temp.to_int(),code_size,bufflen - temp_len))
+				return 0;
+			for(uint32_t i = 0; i < temp.to_int(); i++)
+			{
+				if(_read_code(buffer + temp_len + i * code_size,code_size) >= dict_size.to_int())
+					return 0;
+			}
+			return temp_len + code_size * temp.to_int();
+		}
+	private:
+		typedef std::map<obj_type,uint32_t> index_type;
+		static uint32_t _code_size(uint64_t dict_size)
+		{
+			return dict_size <= 0x100 ? 1 : (dict_size <= 0x10000 ? 2 : 4);
+		}
+		//an 8 byte count is checked against the buffer before the product can wrap
+		static bool _codes_fit(uint64_t count,uint32_t code_size,uint32_t bufflen)
+		{
+			return count <= bufflen && code_size * count <= bufflen;
+		}
+		static uint32_t _read_code(const char* buffer,uint32_t code_size)
+		{
+			if(code_size == 1)
+				return (uint8_t)buffer[0];
+			if(code_size == 2)
+			{
+				uint16_obj code;
+				code.parse_from_buffer(buffer,2);
+				return code.to_int();
+			}
+			uint32_obj code;
+			code.parse_from_buffer(buffer,4);
+			return code.to_int();
+		}
+		//returns false when a code is not in the dictionary
+		bool _decode_codes(const char* buffer,uint32_t first,uint32_t n,uint32_t code_size)
+		{
+			uint32_t dict_size = _dict.size();
+			uint32_t bad = 0;
+			for(uint32_t i = 0; i < n; i++)
+			{
+				uint32_t code = _read_code(buffer + i * code_size,code_size);
+				_codes[first + i] = code;
+				bad |= code >= dict_size;
+			}
+			return bad == 0;
+		}
+		void _encode_codes(char* buffer,uint32_t code_size) const
+		{
+			for(uint32_t i = 0; i < _codes.size(); i++)
+			{
+				if(code_size == 1)
+					buffer[i] = (char)_codes[i];
+				else if(code_size == 2)
+					uint16_obj((uint16_t)_codes[i]).serialize_to_buffer(buffer + i * 2,2);
+				else
+					uint32_obj(_codes[i]).serialize_to_buffer(buffer + i * 4,4);
+			}
+		}
+		void _rebuild_index()
+		{
+			_index.clear();
+			for(uint32_t i = 0; i < _dict.size(); i++)
+				_index.insert(std::make_pair(_dict[i],i));
+			_index_valid = true;
+		}
+	private:
+		dictionary_type _dict;
+		std::vector<uint32_t> _codes;
+		index_type _index;
+		bool _index_valid;
+	};
+
+	//bit packing of delta_packed_list, a group of 8 values of width bits takes exactly width bytes,
+	//value j of a group starts at bit j * width counted from the least significant bit of the first byte.
+	struct _bit_pack
+	{
+		static uint32_t width(uint64_t bits)
+		{
+			uint32_t w = 0;
+			for(; bits != 0; bits >>= 1)
+				++w;
+			return w;
+		}
+		static uint32_t packed_len(uint32_t n,uint32_t width)
+		{
+			return (n + 7) / 8 * width;
+		}
+		//values must fit in width bits, the last group is padded with zeros, width 0 takes no bytes
+		static void pack(const uint64_t* values,uint32_t n,uint32_t width,char* buffer)
+		{
+			memset(buffer,0,packed_len(n,width));
+			if(width == 0)
+				return;
+			for(uint32_t i = 0; i < n; i++)
+			{
+				uint32_t bit = i * width;
+				uint32_t byte = bit / 8;
+				buffer[byte] |= (char)(values[i] << (bit % 8));
+				for(uint32_t done = 8 - bit % 8; done < width; done += 8)
+					buffer[++byte] |= (char)(values[i] >> done);
+			}
+		}
+		static uint64_t load64_le(const char* buffer)
+		{
+			uint64_t word;
+			memcpy(&word,buffer,8);
+#ifdef _BINPROTO_BIG_ENDIAN_HOST
+			word = _binproto_bswap64(word);
+#endif
+			return word;
+		}
+	};
+	//decodes whole groups of zigzag deltas with the width fixed at compile time,
+	//so each value is a load, a shift and a mask, then the running sum from base is stored.
+	//it loads 8 bytes per value, the input must have 8 readable bytes after the packed groups.
+	template<int width>
+	struct _bit_unpack
+	{
+		template<int j>
+		static uint64_t delta(const char* buffer)
+		{
+			const int bit = j * width;
+			const uint64_t mask = width == 64 ? ~(uint64_t)0 : (((uint64_t)1 << (width & 63)) - 1);
+			uint64_t code = _bit_pack::load64_le(buffer + bit / 8) >> (bit % 8);
+			if(bit % 8 + width > 64)
+				code |= (uint64_t)(uint8_t)buffer[bit / 8 + 8] << ((64 - bit % 8) & 63);
+			code &= mask;
+			return (code >> 1) ^ (0 - (code & 1));
+		}
+		template<typename int_type>
+		static void run(const char* buffer,uint64_t base,int_type* values,uint32_t groups)
+		{
+			for(uint32_t g = 0; g < groups; g++)
+			{
+				uint64_t d0 = delta<0>(buffer),d1 = delta<1>(buffer),d2 = delta<2>(buffer),d3 = delta<3>(buffer);
+				uint64_t d4 = delta<4>(buffer),d5 = delta<5>(buffer),d6 = delta<6>(buffer),d7 = delta<7>(buffer);
+				values[0] = (int_type)(base += d0);
+				values[1] = (int_type)(base += d1);
+				values[2] = (int_type)(base += d2);
+				values[3] = (int_type)(base += d3);
+				values[4] = (int_type)(base += d4);
+				values[5] = (int_type)(base += d5);
+				values[6] = (int_type)(base += d6);
+				values[7] = (int_type)(base += d7);
+				buffer += width;
+				values += 8;
+			}
+		}
+	};
+	//_bit_unpack of a run-time width, a constant table so it needs no initialization
+#define _BINPROTO_BIT_UNPACK_8(width) &_bit_unpack<width>::template run<int_type>,&_bit_unpack<width + 1>::template run<int_type>, \
+	&_bit_unpack<width + 2>::template run<int_type>,&_bit_unpack<width + 3>::template run<int_type>, \
+	&_bit_unpack<width + 4>::template run<int_type>,&_bit_unpack<width + 5>::template run<int_type>, \
+	&_bit_unpack<width + 6>::template run<int_type>,&_bit_unpack<width + 7>::template run<int_type>
+	template<typename int_type>
+	inline void _bit_unpack_width(uint32_t width,const char* buffer,uint64_t base,int_type* values,uint32_t groups)
+	{
+		typedef void (*unpack_fn)(const char*,uint64_t,int_type*,uint32_t);
+		static const unpack_fn table[65] = {_BINPROTO_BIT_UNPACK_8(0),_BINPROTO_BIT_UNPACK_8(8),_BINPROTO_BIT_UNPACK_8(16),_BINPROTO_BIT_UNPACK_8(24),
+			_BINPROTO_BIT_UNPACK_8(32),_BINPROTO_BIT_UNPACK_8(40),_BINPROTO_BIT_UNPACK_8(48),_BINPROTO_BIT_UNPACK_8(56),
+			&_bit_unpack<64>::template run<int_type>};
+		table[width](buffer,base,values,groups);
+	}
+
+	//list of integers such as timestamps or sequence numbers, stored as deltas bit-packed in blocks of 128.
+	//the encoding is a list_len_size count, then per block the first value as a num_obj, a width byte
+	//and the zigzag deltas from the previous value in _bit_pack groups, the delta of the first value is 0.
+	//the last block holds the count % 128 remaining values.
+	//the list stays packed in memory, operator[] decodes only the block of the index up to the index,
+	//and values are added to an unpacked last block until it is full.
+	template<typename int_type, int list_len_size = 4>
+	class delta_packed_list
+	{
+	public:
+		typedef int_type value_type;
+		typedef BINPROTO_UINT_TYPE_FROM_SIZE(sizeof(int_type)) uint_type;
+		typedef num_obj<uint_type> base_type;
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(list_len_size)> list_size_type;
+		static const int STATIC_BINARY_LENGTH = 0;
+		enum{BLOCK_SIZE = 128,BITS = sizeof(int_type) * 8,BLOCK_HEAD_LEN = sizeof(int_type) + 1,
+			MAX_BLOCK_LEN = BLOCK_HEAD_LEN + BITS * BLOCK_SIZE / 8};
+	public:
+		delta_packed_list()
+			:_data(8)
+		{
+		}
+		uint32_t size() const
+		{
+			return _offsets.size() * BLOCK_SIZE + _tail.size();
+		}
+		bool empty() const
+		{
+			return size() == 0;
+		}
+		int_type operator[](uint32_t index) const
+		{
+			BINPROTO_ASSERT(index < size(),"delta_packed_list index out of range");
+			uint32_t block = index / BLOCK_SIZE;
+			if(block == _offsets.size())
+				return _tail[index % BLOCK_SIZE];
+			int_type values[BLOCK_SIZE];
+			_decode_block(&_data[_offsets[block]],index % BLOCK_SIZE + 1,values);
+			return values[index % BLOCK_SIZE];
+		}
+		void push_back(int_type value)
+		{
+			BINPROTO_ASSERT(size() < BINPROTO_UINT_MAX_VALUE(typename list_size_type::uint_type),"delta_packed_list is full");
+			_tail.push_back(value);
+			if(_tail.size() < BLOCK_SIZE)
+				return;
+			uint32_t offset = _data.size() - 8;
+			_data.resize(offset + MAX_BLOCK_LEN + 8);
+			uint32_t len = _encode_block(&_tail[0],BLOCK_SIZE,&_data[offset]);
+			_data.resize(offset + len + 8);
+			memset(&_data[offset + len],0,8);
+			_offsets.push_back(offset);
+			_tail.clear();
+		}
+		void clear()
+		{
+			_data.assign(8,0);
+			_offsets.clear();
+			_tail.clear();
+		}
+		template<typename container_type>
+		void decode(container_type& values) const
+		{
+			values.resize(size());
+			for(uint32_t block = 0; block < _offsets.size(); block++)
+				_decode_block(&_data[_offsets[block]],BLOCK_SIZE,&values[block * BLOCK_SIZE]);
+			for(uint32_t i = 0; i < _tail.size(); i++)
+				values[_offsets.size() * BLOCK_SIZE + i] = _tail[i];
+		}
+		bool operator==(const delta_packed_list& other) const
+		{
+			if(size() != other.size())
+				return false;
+			std::vector<int_type> values,other_values;
+			decode(values);
+			other.decode(other_values);
+			return values == other_values;
+		}
+		bool operator!=(const delta_packed_list& other) const
+		{
+			return !(*this == other);
+		}
+	public:
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const
+		{
+			BINPROTO_ASSERT(get_binary_len() <= bufflen,"delta_packed_list serialize error");
+			uint32_t temp_len = list_size_type(size()).serialize_to_buffer(buffer,bufflen);
+			memcpy(buffer + temp_len,&_data[0],_data.size() - 8);
+			temp_len += _data.size() - 8;
+			if(!_tail.empty())
+				temp_len += _encode_block(&_tail[0],_tail.size(),buffer + temp_len);
+			return temp_len;
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			uint32_t temp_len = list_size_type(size()).serialize_to_sink(sink);
+			sink.write(&_data[0],_data.size() - 8);
+			temp_len += _data.size() - 8;
+			if(!_tail.empty())
+			{
+				uint32_t len = _encode_block(&_tail[0],_tail.size(),sink.reserve(MAX_BLOCK_LEN));
+				sink.commit(len);
+				temp_len += len;
+			}
+			return temp_len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			list_size_type temp;
+			_BINPROTO_PARSE_ENSURE(list_len_size <= bufflen,"delta_packed_list length parse error");
+			uint32_t temp_len = temp.parse_from_buffer(buffer,bufflen);
+			uint32_t len = 0;
+			_BINPROTO_PARSE_ENSURE(_scan_blocks(buffer + temp_len,bufflen - temp_len,temp.to_int(),len) == parse_status::ok_code,"delta_packed_list parse error");
+			_load(buffer + temp_len,(uint32_t)temp.to_int(),len);
+			return temp_len + len;
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			list_size_type temp;
+			uint32_t temp_len = temp.parse_from_buffer(buffer,bufflen,status);
+			if(!status.ok())
+				return 0;
+			uint32_t len = 0;
+			parse_status::error_code code = _scan_blocks(buffer + temp_len,bufflen - temp_len,temp.to_int(),len);
+			if(code != parse_status::ok_code)
+			{
+				status.fail(code);
+				return status.fail_at(temp_len);
+			}
+			_load(buffer + temp_len,(uint32_t)temp.to_int(),len);
+			return temp_len + len;
+		}
+		//blocks are gathered as they come, a width larger than the type fails the cursor and leaves the list empty
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			if(cursor.at(depth).step == 0)
+			{
+				list_size_type temp;
+				if(!temp.parse_some(buffer,bufflen,cursor,depth + 1))
+					return false;
+				cursor.reset(depth + 1);
+				if(temp.to_int() > UINT32_MAX)
+				{
+					clear();
+					return cursor.fail();
+				}
+				parse_cursor::frame& frame = cursor.at(depth);
+				frame.step = 1;
+				frame.count = temp.to_int();
+				_data.clear();
+				_offsets.clear();
+			}
+			parse_cursor::frame& frame = cursor.at(depth);
+			uint32_t count = (uint32_t)frame.count;
+			uint32_t tail_start = 0;
+			while((uint64_t)frame.index * BLOCK_SIZE < count)
+			{
+				uint32_t n = count - frame.index * BLOCK_SIZE;
+				n = n < BLOCK_SIZE ? n : (uint32_t)BLOCK_SIZE;
+				uint32_t start = _data.size() - frame.partial_len;
+				uint32_t need = BLOCK_HEAD_LEN;
+				if(frame.partial_len >= BLOCK_HEAD_LEN)
+				{
+					uint32_t width = (uint8_t)_data[start + sizeof(int_type)];
+					if(width > BITS)
+					{
+						clear();
+						return cursor.fail();
+					}
+					need += _bit_pack::packed_len(n,width);
+				}
+				if(frame.partial_len < need)
+				{
+					if(bufflen == 0)
+						return false;
+					uint32_t take = need - frame.partial_len;
+					take = take < bufflen ? take : bufflen;
+					_data.insert(_data.end(),buffer,buffer + take);
+					buffer += take;
+					bufflen -= take;
+					frame.partial_len += take;
+					continue;
+				}
+				if(n == BLOCK_SIZE)
+					_offsets.push_back(start);
+				else
+					tail_start = start;
+				frame.partial_len = 0;
+				++frame.index;
+			}
+			if(count % BLOCK_SIZE == 0)
+				tail_start = _data.size();
+			_tail.resize(count % BLOCK_SIZE);
+			if(!_tail.empty())
+				_decode_copy(&_data[tail_start],_data.size() - tail_start,_tail.size(),&_tail[0]);
+			_data.resize(tail_start);
+			_data.resize(tail_start + 8,0);
+			return true;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			uint32_t temp_len = list_len_size + _data.size() - 8;
+			if(!_tail.empty())
+				temp_len += BLOCK_HEAD_LEN + _bit_pack::packed_len(_tail.size(),_delta_width(&_tail[0],_tail.size()));
+			return temp_len;
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			uint32_t temp_len = validate_buffer(buffer,bufflen);
+			_BINPROTO_PARSE_ENSURE(temp_len != 0,"delta_packed_list parse error");
+			return temp_len;
+		}
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			list_size_type temp;
+			if(bufflen < list_len_size)
+				return 0;
+			uint32_t temp_len = temp.parse_from_buffer(buffer,bufflen);
+			uint32_t len = 0;
+			if(_scan_blocks(buffer + temp_len,bufflen - temp_len,temp.to_int(),len) != parse_status::ok_code)
+				return 0;
+			return temp_len + len;
+		}
+	private:
+		static uint64_t _zigzag(uint_type delta)
+		{
+			return (uint_type)(((uint_type)(delta << 1)) ^ (uint_type)(0 - (delta >> (BITS - 1))));
+		}
+		static uint32_t _delta_width(const int_type* values,uint32_t n)
+		{
+			uint64_t bits = 0;
+			for(uint32_t i = 1; i < n; i++)
+				bits |= _zigzag((uint_type)((uint_type)values[i] - (uint_type)values[i - 1]));
+			return _bit_pack::width(bits);
+		}
+		//buffer must have MAX_BLOCK_LEN bytes, returns the block length
+		static uint32_t _encode_block(const int_type* values,uint32_t n,char* buffer)
+		{
+			uint64_t codes[BLOCK_SIZE];
+			uint64_t bits = 0;
+			codes[0] = 0;
+			for(uint32_t i = 1; i < n; i++)
+			{
+				codes[i] = _zigzag((uint_type)((uint_type)values[i] - (uint_type)values[i - 1]));
+				bits |= codes[i];
+			}
+			uint32_t width = _bit_pack::width(bits);
+			base_type((uint_type)values[0]).serialize_to_buffer(buffer,sizeof(int_type));
+			buffer[sizeof(int_type)] = (char)width;
+			_bit_pack::pack(codes,n,width,buffer + BLOCK_HEAD_LEN);
+			return BLOCK_HEAD_LEN + _bit_pack::packed_len(n,width);
+		}
+		//decodes the first n values of a block rounded up to a group of 8, so values must have room for them,
+		//the block must have 8 readable bytes after it
+		static void _decode_block(const char* block,uint32_t n,int_type* values)
+		{
+			base_type base;
+			base.parse_from_buffer(block,sizeof(int_type));
+			_bit_unpack_width((uint8_t)block[sizeof(int_type)],block + BLOCK_HEAD_LEN,(uint64_t)base.to_int(),values,(n + 7) / 8);
+		}
+		//for a block without the 8 bytes after it, such as the last block of an input buffer
+		static void _decode_copy(const char* block,uint32_t len,uint32_t n,int_type* values)
+		{
+			char temp[MAX_BLOCK_LEN + 8];
+			int_type temp_values[BLOCK_SIZE];
+			memcpy(temp,block,len);
+			memset(temp + len,0,8);
+			_decode_block(temp,n,temp_values);
+			memcpy(values,temp_values,n * sizeof(int_type));
+		}
+		//the list holds at most UINT32_MAX values, an 8 byte count past it is rejected rather than cut
+		static parse_status::error_code _scan_blocks(const char* buffer,uint32_t bufflen,uint64_t count,uint32_t& len)
+		{
+			if(count > UINT32_MAX)
+				return parse_status::invalid_data;
+			uint32_t pos = 0;
+			for(uint64_t first = 0; first < count; first += BLOCK_SIZE)
+			{
+				uint32_t n = count - first < BLOCK_SIZE ? (uint32_t)(count - first) : (uint32_t)BLOCK_SIZE;
+				if(bufflen - pos < BLOCK_HEAD_LEN)
+					return parse_status::short_buffer;
+				uint32_t width = (uint8_t)buffer[pos + sizeof(int_type)];
+				if(width > BITS)
+					return parse_status::invalid_data;
+				uint32_t block_len = BLOCK_HEAD_LEN + _bit_pack::packed_len(n,width);
+				if(bufflen - pos < block_len)
+					return parse_status::short_buffer;
+				pos += block_len;
+			}
+			len = pos;
+			return parse_status::ok_code;
+		}
+		//buffer holds count values in blocks of len bytes, already scanned
+		void _load(const char* buffer,uint32_t count,uint32_t len)
+		{
+			_offsets.resize(count / BLOCK_SIZE);
+			uint32_t pos = 0;
+			for(uint32_t block = 0; block < _offsets.size(); block++)
+			{
+				_offsets[block] = pos;
+				pos += BLOCK_HEAD_LEN + _bit_pack::packed_len(BLOCK_SIZE,(uint8_t)buffer[pos + sizeof(int_type)]);
+			}
+			_data.resize(pos + 8);
+			memcpy(&_data[0],buffer,pos);
+			memset(&_data[pos],0,8);
+			_tail.resize(count % BLOCK_SIZE);
+			if(!_tail.empty())
+				_decode_copy(buffer + pos,len - pos,_tail.size(),&_tail[0]);
+		}
+	private:
+		//the whole blocks followed by 8 zero bytes
+		std::vector<char> _data;
+		std::vector<uint32_t> _offsets;
+		std::vector<int_type> _tail;
+	};
+
+	//field which may be absent, inside a packet its presence is a bit of the packet presence bitmap,
+	//elsewhere, such as in a list, it is one byte 0 or 1 before the value.
+	//reset() keeps the value object, so parsing into it again reuses its capacity.
+	template<typename obj_type>
+	class optional_obj
+	{
+	public:
+		BINPROTO_STATIC_ASSERT((_binproto_is_binproto_obj<obj_type>::value),"optional_obj obj type must be a binproto object type");
+	public:
+		typedef obj_type value_type;
+		static const int STATIC_BINARY_LENGTH = 0;
+	public:
+		optional_obj()
+			:_value(),_present(false)
+		{
+		}
+		optional_obj(const obj_type& value)
+			:_value(value),_present(true)
+		{
+		}
+		optional_obj& operator=(const obj_type& value)
+		{
+			_value = value;
+			_present = true;
+			return *this;
+		}
+		bool has_value() const
+		{
+			return _present;
+		}
+		obj_type& value()
+		{
+			BINPROTO_ASSERT(_present,"optional_obj has no value");
+			return _value;
+		}
+		const obj_type& value() const
+		{
+			BINPROTO_ASSERT(_present,"optional_obj has no value");
+			return _value;
+		}
+		//marks the value present and returns it for filling in
+		obj_type& emplace()
+		{
+			_present = true;
+			return _value;
+		}
+		void reset()
+		{
+			_present = false;
+		}
+		bool operator==(const optional_obj& other) const
+		{
+			return _present == other._present && (!_present || _value == other._value);
+		}
+		bool operator!=(const optional_obj& other) const
+		{
+			return !(*this == other);
+		}
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const
+		{
+			BINPROTO_ASSERT(bufflen >= 1,"optional_obj serialize error");
+			buffer[0] = _present ? 1 : 0;
+			if(!_present)
+				return 1;
+			return 1 + _value.serialize_to_buffer(buffer + 1,bufflen - 1);
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			*sink.reserve(1) = _present ? 1 : 0;
+			sink.commit(1);
+			if(!_present)
+				return 1;
+			return 1 + _value.serialize_to_sink(sink);
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(bufflen >= 1 && (uint8_t)buffer[0] <= 1,"optional_obj parse error");
+			_present = buffer[0] != 0;
+			if(!_present)
+				return 1;
+			_BINPROTO_PARSE_TRY;
+			return 1 + _value.parse_from_buffer(buffer + 1,bufflen - 1);
+			_BINPROTO_PARSE_CATCH("optional_obj");
+		}
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			if(bufflen < 1)
+				return status.fail(parse_status::short_buffer);
+			if((uint8_t)buffer[0] > 1)
+				return status.fail(parse_status::invalid_data);
+			_present = buffer[0] != 0;
+			if(!_present)
+				return 1;
+			uint32_t len = _value.parse_from_buffer(buffer + 1,bufflen - 1,status);
+			if(!status.ok())
+				return status.fail_at(1);
+			return 1 + len;
+		}
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			if(cursor.at(depth).step == 0)
+			{
+				if(bufflen == 0)
+					return false;
+				if((uint8_t)buffer[0] > 1)
+					return cursor.fail();
+				_present = buffer[0] != 0;
+				++buffer;
+				--bufflen;
+				if(!_present)
+					return true;
+				cursor.at(depth).step = 1;
+			}
+			if(!_value.parse_some(buffer,bufflen,cursor,depth + 1))
+				return false;
+			cursor.reset(depth + 1);
+			return true;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			return _present ? 1 + _value.get_binary_len() : 1;
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(bufflen >= 1 && (uint8_t)buffer[0] <= 1,"optional_obj parse error");
+			if(buffer[0] == 0)
+				return 1;
+			_BINPROTO_PARSE_TRY;
+			return 1 + obj_type::skip_from_buffer(buffer + 1,bufflen - 1);
+			_BINPROTO_PARSE_CATCH("optional_obj");
+		}
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			if(bufflen < 1 || (uint8_t)buffer[0] > 1)
+				return 0;
+			if(buffer[0] == 0)
+				return 1;
+			uint32_t len = obj_type::validate_buffer(buffer + 1,bufflen - 1);
+			return len == 0 ? 0 : 1 + len;
+		}
+		obj_type& _payload()
+		{
+			return _value;
+		}
+		const obj_type& _payload() const
+		{
+			return _value;
+		}
+	private:
+		obj_type _value;
+		bool _present;
+	};
+
+	//how a packet field is encoded, optional_obj fields are their value guarded by the presence bitmap
+	template<typename field_type>
+	struct _optional_traits
+	{
+		enum{is_optional = 0};
+		typedef field_type payload_type;
+		typedef typename _binproto_view_traits<field_type>::type view_type;
+		static bool present(const field_type&)
+		{
+			return true;
+		}
+		static field_type& payload(field_type& field)
+		{
+			return field;
+		}
+		static const field_type& payload(const field_type& field)
+		{
+			return field;
+		}
+		static void emplace(field_type&)
+		{
+		}
+		static void reset(field_type&)
+		{
+		}
+		static view_type make_view(const char* buffer,uint32_t bufflen,bool)
+		{
+			return _binproto_view_traits<field_type>::make(buffer,bufflen);
+		}
+	};
+	template<typename obj_type>
+	struct _optional_traits<optional_obj<obj_type> >
+	{
+		enum{is_optional = 1};
+		typedef obj_type payload_type;
+		typedef optional_obj<obj_type> view_type;
+		static bool present(const optional_obj<obj_type>& field)
+		{
+			return field.has_value();
+		}
+		static obj_type& payload(optional_obj<obj_type>& field)
+		{
+			return field._payload();
+		}
+		static const obj_type& payload(const optional_obj<obj_type>& field)
+		{
+			return field._payload();
+		}
+		static void emplace(optional_obj<obj_type>& field)
+		{
+			field.emplace();
+		}
+		static void reset(optional_obj<obj_type>& field)
+		{
+			field.reset();
+		}
+		static view_type make_view(const char* buffer,uint32_t bufflen,bool present)
+		{
+			view_type field;
+			if(present)
+				field.emplace().parse_from_buffer(buffer,bufflen);
+			return field;
+		}
+	};
+
+	//columns of columnar_obj_list, one per packet field, chosen by _column_traits. every column has
+	//	uint32_t append(buffer,bufflen,present)	parses one field at the end, an absent optional field takes no bytes
+	//	uint32_t serialize(row,buffer,bufflen) const, uint32_t binary_len(row) const, bool present(row) const
+	//	push_back(field), get(row,field) const, size(), reserve(rows), clear()
+
+	//numbers in one native array, data() and size() span the column
+	template<typename numtype, typename byte_order_type>
+	class num_column
+	{
+	public:
+		typedef numtype value_type;
+		typedef num_obj<numtype,byte_order_type> obj_type;
+	public:
+		const numtype* data() const
+		{
+			return _values.empty() ? NULL : &_values[0];
+		}
+		uint32_t size() const
+		{
+			return _values.size();
+		}
+		numtype operator[](uint32_t row) const
+		{
+			return _values[row];
+		}
+		uint32_t append(const char* buffer,uint32_t bufflen,bool) BINPROTO_THROW_SPEC
+		{
+			obj_type obj;
+			uint32_t temp_len = obj.parse_from_buffer(buffer,bufflen);
+			_values.push_back(obj.to_int());
+			return temp_len;
+		}
+		uint32_t serialize(uint32_t row,char* buffer,uint32_t bufflen) const
+		{
+			return obj_type(_values[row]).serialize_to_buffer(buffer,bufflen);
+		}
+		uint32_t binary_len(uint32_t) const
+		{
+			return sizeof(numtype);
+		}
+		bool present(uint32_t) const
+		{
+			return true;
+		}
+		void push_back(const obj_type& field)
+		{
+			_values.push_back(field.to_int());
+		}
+		void get(uint32_t row,obj_type& field) const
+		{
+			field = _values[row];
+		}
+		void reserve(uint32_t rows)
+		{
+			_values.reserve(rows);
+		}
+		void clear()
+		{
+			_values.clear();
+		}
+	private:
+		std::vector<numtype> _values;
+	};
+
+	//variable length strings in one byte array, string row is bytes() + offsets()[row] to bytes() + offsets()[row + 1]
+	template<int len_size, typename field_type>
+	class string_column
+	{
+	public:
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(len_size)> len_type;
+	public:
+		string_column()
+			:_offsets(1,0)
+		{
+		}
+		const char* data(uint32_t row) const
+		{
+			return bytes() + _offsets[row];
+		}
+		uint32_t size(uint32_t row) const
+		{
+			return _offsets[row + 1] - _offsets[row];
+		}
+		uint32_t size() const
+		{
+			return _offsets.size() - 1;
+		}
+		const std::vector<uint32_t>& offsets() const
+		{
+			return _offsets;
+		}
+		const char* bytes() const
+		{
+			return _bytes.empty() ? "" : &_bytes[0];
+		}
+		uint32_t append(const char* buffer,uint32_t bufflen,bool) BINPROTO_THROW_SPEC
+		{
+			len_type temp;
+			_BINPROTO_PARSE_ENSURE(bufflen >= len_size,"variable_len_string parse error");
+			temp.parse_from_buffer(buffer,bufflen);
+			_BINPROTO_PARSE_ENSURE(temp.to_int() <= bufflen - len_size,"variable_len_string parse error");
+			_append_bytes(buffer + len_size,temp.to_int());
+			return len_size + temp.to_int();
+		}
+		uint32_t serialize(uint32_t row,char* buffer,uint32_t bufflen) const
+		{
+			BINPROTO_ASSERT(binary_len(row) <= bufflen,"variable_len_string serialize error");
+			len_type(size(row)).serialize_to_buffer(buffer,bufflen);
+			memcpy(buffer + len_size,data(row),size(row));
+			return len_size + size(row);
+		}
+		uint32_t binary_len(uint32_t row) const
+		{
+			return len_size + size(row);
+		}
+		bool present(uint32_t) const
+		{
+			return true;
+		}
+		void push_back(const field_type& field)
+		{
+			_append_bytes(field.c_str(),field.size());
+		}
+		void get(uint32_t row,field_type& field) const
+		{
+			field.assign(data(row),size(row));
+		}
+		void reserve(uint32_t rows)
+		{
+			_offsets.reserve(rows + 1);
+		}
+		void clear()
+		{
+			_offsets.resize(1);
+		}
+	private:
+		//_bytes grows by doubling and keeps its size, the used length is the last offset
+		void _append_bytes(const char* str,uint32_t len)
+		{
+			uint32_t pos = _offsets.back();
+			if(_bytes.size() - pos < len)
+			{
+				size_t capacity = _bytes.size() * 2;
+				_bytes.resize(capacity < pos + len ? pos + len : capacity);
+			}
+			if(len != 0)
+				memcpy(&_bytes[pos],str,len);
+			_offsets.push_back(pos + len);
+		}
+	private:
+		std::vector<uint32_t> _offsets;
+		std::vector<char> _bytes;
+	};
+
+	//fixed length strings back to back, row is str_len bytes at data() + row * str_len
+	template<int str_len>
+	class fixed_string_column
+	{
+	public:
+		typedef fixed_len_string<str_len> obj_type;
+	public:
+		fixed_string_column()
+			:_size(0)
+		{
+		}
+		const char* data() const
+		{
+			return _bytes.empty() ? NULL : &_bytes[0];
+		}
+		const char* data(uint32_t row) const
+		{
+			return &_bytes[(size_t)row * str_len];
+		}
+		uint32_t size() const
+		{
+			return _size;
+		}
+		uint32_t append(const char* buffer,uint32_t bufflen,bool) BINPROTO_THROW_SPEC
+		{
+			_BINPROTO_PARSE_ENSURE(bufflen >= str_len,"fixed_len_string parse error");
+			_append_bytes(buffer);
+			return str_len;
+		}
+		//serialize_row hands every column the row_binary_len it reported
+		uint32_t serialize(uint32_t row,char* buffer,uint32_t /*bufflen*/) const
+		{
+			memcpy(buffer,data(row),str_len);
+			return str_len;
+		}
+		uint32_t binary_len(uint32_t) const
+		{
+			return str_len;
+		}
+		bool present(uint32_t) const
+		{
+			return true;
+		}
+		void push_back(const obj_type& field)
+		{
+			_append_bytes(field.c_str());
+		}
+		void get(uint32_t row,obj_type& field) const
+		{
+			field.assign(data(row),str_len);
+		}
+		void reserve(uint32_t rows)
+		{
+			if(_bytes.size() < (size_t)rows * str_len)
+				_bytes.resize((size_t)rows * str_len);
+		}
+		void clear()
+		{
+			_size = 0;
+		}
+	private:
+		//_bytes grows by doubling and keeps its size, like string_column
+		void _append_bytes(const char* str)
+		{
+			size_t pos = (size_t)_size * str_len;
+			if(_bytes.size() - pos < (size_t)str_len)
+			{
+				size_t capacity = _bytes.size() * 2;
+				_bytes.resize(capacity < pos + str_len ? pos + str_len : capacity);
+			}
+			memcpy(&_bytes[pos],str,str_len);
+			++_size;
+		}
+	private:
+		std::vector<char> _bytes;
+		uint32_t _size;
+	};
+
+	//any other field type, kept as objects, an optional field is an optional_obj per row
+	template<typename field_type>
+	class obj_column
+	{
+	public:
+		typedef _optional_traits<field_type> traits;
+	public:
+		const field_type& operator[](uint32_t row) const
+		{
+			return _values[row];
+		}
+		uint32_t size() const
+		{
+			return _values.size();
+		}
+		uint32_t append(const char* buffer,uint32_t bufflen,bool present) BINPROTO_THROW_SPEC
+		{
+			_values.push_back(field_type());
+			if(!present)
+				return 0;
+			field_type& field = _values.back();
+			traits::emplace(field);
+			return traits::payload(field).parse_from_buffer(buffer,bufflen);
+		}
+		uint32_t serialize(uint32_t row,char* buffer,uint32_t bufflen) const
+		{
+			return present(row) ? traits::payload(_values[row]).serialize_to_buffer(buffer,bufflen) : 0;
+		}
+		uint32_t binary_len(uint32_t row) const
+		{
+			return present(row) ? traits::payload(_values[row]).get_binary_len() : 0;
+		}
+		bool present(uint32_t row) const
+		{
+			return traits::present(_values[row]);
+		}
+		void push_back(const field_type& field)
+		{
+			_values.push_back(field);
+		}
+		void get(uint32_t row,field_type& field) const
+		{
+			field = _values[row];
+		}
+		void reserve(uint32_t rows)
+		{
+			_values.reserve(rows);
+		}
+		void clear()
+		{
+			_values.clear();
+		}
+	private:
+		std::vector<field_type> _values;
+	};
+
+	template<typename field_type>
+	struct _column_traits
+	{
+		typedef obj_column<field_type> type;
+	};
+	template<typename numtype, typename byte_order_type>
+	struct _column_traits<num_obj<numtype,byte_order_type> >
+	{
+		typedef num_column<numtype,byte_order_type> type;
+	};
+	template<int len_size, typename alloc_type>
+	struct _column_traits<variable_len_string<len_size,alloc_type> >
+	{
+		typedef string_column<len_size,variable_len_string<len_size,alloc_type> > type;
+	};
+	template<int str_len>
+	struct _column_traits<fixed_len_string<str_len> >
+	{
+		typedef fixed_string_column<str_len> type;
+	};
+
+	//list of packets in the encoding of binary_obj_list<packet_type,list_len_size>, held as one column per field,
+	//so a scan of one field such as columns().age.data() reads only that field.
+	//packet_type is a BINPROTO_DEFINE_PACKET packet, its columns struct has a member of the same name per field.
+	//rows are read back as whole packets by get().
+	template<typename packet_type, int list_len_size>
+	class columnar_obj_list
+	{
+	public:
+		typedef typename packet_type::columns columns_type;
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(list_len_size)> list_size_type;
+		typedef binary_obj_list<packet_type,list_len_size> row_list_type;
+		static const int STATIC_BINARY_LENGTH = 0;
+	public:
+		columnar_obj_list()
+			:_size(0)
+		{
+		}
+		uint32_t size() const
+		{
+			return _size;
+		}
+		bool empty() const
+		{
+			return _size == 0;
+		}
+		const columns_type& columns() const
+		{
+			return _columns;
+		}
+		void push_back(const packet_type& packet)
+		{
+			BINPROTO_ASSERT(_size < BINPROTO_UINT_MAX_VALUE(typename list_size_type::uint_type),"columnar_obj_list is full");
+			_columns.push_back(packet);
+			++_size;
+		}
+		void get(uint32_t row,packet_type& packet) const
+		{
+			BINPROTO_ASSERT(row < _size,"columnar_obj_list index out of range");
+			_columns.get(row,packet);
+		}
+		packet_type operator[](uint32_t row) const
+		{
+			packet_type packet;
+			get(row,packet);
+			return packet;
+		}
+		void clear()
+		{
+			_columns.clear();
+			_size = 0;
+		}
+	public:
+		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const
+		{
+			BINPROTO_ASSERT(list_len_size <= bufflen,"columnar_obj_list length serialize error");
+			uint32_t temp_len = list_size_type(_size).serialize_to_buffer(buffer,bufflen);
+			for(uint32_t row = 0; row < _size; row++)
+				temp_len += _columns.serialize_row(row,buffer + temp_len,bufflen - temp_len);
+			return temp_len;
+		}
+		template<typename sink_type>
+		uint32_t serialize_to_sink(sink_type& sink) const
+		{
+			uint32_t temp_len = list_size_type(_size).serialize_to_sink(sink);
+			for(uint32_t row = 0; row < _size; row++)
+			{
+				uint32_t row_len = _columns.row_binary_len(row);
+				_columns.serialize_row(row,sink.reserve(row_len),row_len);
+				sink.commit(row_len);
+				temp_len += row_len;
+			}
+			return temp_len;
+		}
+		//rows are parsed straight into the columns, a failed parse leaves the list empty
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			list_size_type temp;
+			_BINPROTO_PARSE_ENSURE(list_len_size <= bufflen,"columnar_obj_list length parse error");
+			uint32_t temp_len = temp.parse_from_buffer(buffer,bufflen);
+			clear();
+			_BINPROTO_PARSE_ENSURE(temp.to_int() <= UINT32_MAX,"columnar_obj_list parse error");
+			_reserve(temp.to_int(),bufflen - temp_len);
+			_BINPROTO_PARSE_TRY;
+			for(uint32_t row = 0; row < temp.to_int(); row++)
+			{
+				temp_len += _columns.parse_row(buffer + temp_len,bufflen - temp_len);
+				++_size;
+			}
+			return temp_len;
+			_BINPROTO_PARSE_CATCH(_failed());
+		}
+		//rows go through one reused packet, which reports the failing field
+		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,parse_status& status)
+		{
+			status.reset();
+			list_size_type temp;
+			uint32_t temp_len = temp.parse_from_buffer(buffer,bufflen,status);
+			if(!status.ok())
+				return 0;
+			clear();
+			if(temp.to_int() > UINT32_MAX)
+				return status.fail(parse_status::invalid_data);
+			_reserve(temp.to_int(),bufflen - temp_len);
+			for(uint32_t row = 0; row < temp.to_int(); row++)
+			{
+				uint32_t row_len = _row.parse_from_buffer(buffer + temp_len,bufflen - temp_len,status);
+				if(!status.ok())
+				{
+					clear();
+					return status.fail_at(temp_len);
+				}
+				push_back(_row);
+				temp_len += row_len;
+			}
+			return temp_len;
+		}
+		bool parse_some(const char*& buffer,uint32_t& bufflen,parse_cursor& cursor,uint32_t depth)
+		{
+			if(cursor.at(depth).step == 0)
+			{
+				list_size_type temp;
+				if(!temp.parse_some(buffer,bufflen,cursor,depth + 1))
+					return false;
+				cursor.reset(depth + 1);
+				clear();
+				//the row index of the frame and the list size are 32 bits
+				if(temp.to_int() > UINT32_MAX)
+					return cursor.fail();
+				parse_cursor::frame& frame = cursor.at(depth);
+				frame.step = 1;
+				frame.count = temp.to_int();
+			}
+			while(cursor.at(depth).index < cursor.at(depth).count)
+			{
+				if(!_row.parse_some(buffer,bufflen,cursor,depth + 1))
+					return false;
+				cursor.reset(depth + 1);
+				push_back(_row);
+				++cursor.at(depth).index;
+			}
+			return true;
+		}
+		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
+		uint32_t get_binary_len() const
+		{
+			uint32_t temp_len = list_len_size;
+			for(uint32_t row = 0; row < _size; row++)
+				temp_len += _columns.row_binary_len(row);
+			return temp_len;
+		}
+		static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC
+		{
+			return row_list_type::skip_from_buffer(buffer,bufflen);
+		}
+		static uint32_t validate_buffer(const char* buffer,uint32_t bufflen)
+		{
+			return row_list_type::validate_buffer(buffer,bufflen);
+		}
+	private:
+		//the reservation is capped at the bytes left, a bogus count of rows with fields can not pass that,
+		//rows of packets without fields take no bytes and are not reserved past it either
+		void _reserve(uint32_t rows,uint32_t bufflen)
+		{
+			_columns.reserve(rows < bufflen ? rows : bufflen);
+		}
+		const char* _failed()
+		{
+			clear();
+			return "columnar_obj_list";
+		}
+	private:
+		columns_type _columns;
+		uint32_t _size;
+		packet_type _row;
+	};
+
+	//incremental decoder for byte streams, feed() takes arbitrary chunks and keeps its position
+	//inside nested lists and strings, so no byte is parsed twice.
+	//string views can not be decoded this way, their bytes would not outlive the chunk.
+	template<typename packet_type>
+	class stream_decoder
+	{
+	public:
+		enum result
+		{
+			need_more,
+			complete,
+			malformed
+		};
+	public:
+		//consumed returns how many bytes of the chunk were taken,
+		//bytes after a complete packet are left for the next feed().
+		//after malformed the stream is out of sync, feed() keeps returning malformed until reset().
+		result feed(const char* buffer,uint32_t bufflen,uint32_t& consumed)
+		{
+			consumed = 0;
+			if(_cursor.failed())
+				return malformed;
+			uint32_t left = bufflen;
+			bool done = _packet.parse_some(buffer,left,_cursor,0);
+			consumed = bufflen - left;
+			if(_cursor.failed())
+				return malformed;
+			if(!done)
+				return need_more;
+			_cursor.clear();
+			return complete;
+		}
+		//the packet is whole only after feed() returned complete
+		packet_type& packet()
+		{
+			return _packet;
+		}
+		const packet_type& packet() const
+		{
+			return _packet;
+		}
+		bool error() const
+		{
+			return _cursor.failed();
+		}
+		//drops a partially decoded packet and a malformed state
+		void reset()
+		{
+			_cursor.clear();
+		}
+	private:
+		packet_type _packet;
+		parse_cursor _cursor;
+	};
+
+	//length-prefixed framing, a frame is
+	//	|  body length  |  len_size bytes  |
+	//	|    type id    |  id_size bytes, omitted when id_size is 0  |
+	//	|     body      |  serialized packet  |
+	template<int id_size>
+	struct _frame_type_id
+	{
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(id_size)> id_type;
+		static void serialize(uint32_t type_id,char* buffer)
 		{
-			return memcmp(_str,other._str,STATIC_BINARY_LENGTH) != 0;
+			id_type(type_id).serialize_to_buffer(buffer,id_size);
 		}
-		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const 
+		static uint32_t parse(const char* buffer)
 		{
-			BINPROTO_ASSERT(STATIC_BINARY_LENGTH <= bufflen,"fixed_len_string serialize error");
-			memcpy(buffer,_str,STATIC_BINARY_LENGTH);
-			return STATIC_BINARY_LENGTH;
+			id_type temp;
+			temp.parse_from_buffer(buffer,id_size);
+			return temp.to_int();
 		}
-		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) throw(exception)
+	};
+	template<>
+	struct _frame_type_id<0>
+	{
+		static void serialize(uint32_t,char*)
 		{
-			_BINPROTO_PARSE_ENSURE(STATIC_BINARY_LENGTH <= bufflen,"fixed_len_string parse error");
-			memcpy(_str,buffer,STATIC_BINARY_LENGTH);
-			return STATIC_BINARY_LENGTH;
 		}
-		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
-		uint32_t get_binary_len() const
+		static uint32_t parse(const char*)
 		{
-			return STATIC_BINARY_LENGTH;
+			return 0;
 		}
-	private:
-		mutable char _str[STATIC_BINARY_LENGTH + 1];
 	};
 
-	template<typename obj_type, int list_len_size>
-	class binary_obj_list
+	template<int len_size, int id_size = 0>
+	class frame_format
 	{
 	public:
-		BINPROTO_STATIC_ASSERT((_binproto_is_binproto_obj<obj_type>::value),"binary_obj_list obj type must be a binproto object type");
-	public:
-		static const int STATIC_BINARY_LENGTH = 0;
-		static const int list_size_len = list_len_size;
-		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(list_len_size)> list_size_type;
-	public:
-		typedef std::vector<obj_type> container;
-		typedef typename container::iterator iterator;
-		typedef typename container::const_iterator const_iterator;
-		typedef typename container::reverse_iterator reverse_iterator;
-		typedef typename container::const_reverse_iterator const_reverse_iterator;
+		typedef num_obj<BINPROTO_UINT_TYPE_FROM_SIZE(len_size)> len_type;
+		static const int HEADER_LENGTH = len_size + id_size;
 	public:
-		binary_obj_list():_array()
-		{
-		}
-		binary_obj_list(const binary_obj_list& other)
-			:_array(other._array)
+		static uint32_t serialize_header(uint32_t body_len,uint32_t type_id,char* buffer,uint32_t bufflen)
 		{
+			BINPROTO_ASSERT(HEADER_LENGTH <= bufflen,"frame header serialize error");
+			BINPROTO_ASSERT(body_len <= BINPROTO_UINT_MAX_VALUE(typename len_type::uint_type),"frame body len must not larger than len_size max value");
+			len_type(body_len).serialize_to_buffer(buffer,bufflen);
+			_frame_type_id<id_size>::serialize(type_id,buffer + len_size);
+			return HEADER_LENGTH;
 		}
-		iterator begin()
+		//returns HEADER_LENGTH, or 0 when the buffer is shorter than a header
+		//or the body length does not fit uint32_t (only possible when len_size is 8)
+		static uint32_t parse_header(const char* buffer,uint32_t bufflen,uint32_t& body_len,uint32_t& type_id)
 		{
-			return _array.begin();
+			if(bufflen < HEADER_LENGTH)
+				return 0;
+			len_type temp;
+			temp.parse_from_buffer(buffer,bufflen);
+			uint64_t len = temp.to_int();
+			if(len > UINT32_MAX)
+				return 0;
+			body_len = (uint32_t)len;
+			type_id = _frame_type_id<id_size>::parse(buffer + len_size);
+			return HEADER_LENGTH;
 		}
-		iterator end()
+		template<typename packet_type>
+		static uint32_t serialize_frame(const packet_type& packet,uint32_t type_id,char* buffer,uint32_t bufflen)
 		{
-			return _array.end();
+			uint32_t body_len = packet.get_binary_len();
+			BINPROTO_ASSERT(HEADER_LENGTH + body_len <= bufflen,"frame serialize error");
+			serialize_header(body_len,type_id,buffer,bufflen);
+			return HEADER_LENGTH + packet.serialize_to_buffer(buffer + HEADER_LENGTH,bufflen - HEADER_LENGTH);
 		}
-		const_iterator begin() const
+		template<typename packet_type, typename sink_type>
+		static uint32_t serialize_frame_to_sink(const packet_type& packet,uint32_t type_id,sink_type& sink)
 		{
-			return _array.begin();
+			serialize_header(packet.get_binary_len(),type_id,sink.reserve(HEADER_LENGTH),HEADER_LENGTH);
+			sink.commit(HEADER_LENGTH);
+			return HEADER_LENGTH + packet.serialize_to_sink(sink);
 		}
-		const_iterator end() const
+	};
+
+	//a complete frame handed out by ring_frame_decoder
+	struct frame_view
+	{
+		uint32_t type_id;
+		const char* data;
+		uint32_t size;
+	};
+
+	//finds complete frames in a fixed-capacity ring buffer without copying them,
+	//a frame which wraps around the end of the ring is linearized once into a side buffer.
+	//the producer reads from the socket into write_space()/commit_write(),
+	//the consumer loops next_frame() until it returns false.
+	//a frame view is valid until the next write to the decoder.
+	template<typename frame_format_type>
+	class ring_frame_decoder
+	{
+	public:
+		//capacity is rounded up to a power of two, frames larger than it are an error,
+		//capacities past 2^31 are cut to 2^31, the largest power of two of uint32_t
+		explicit ring_frame_decoder(uint32_t capacity)
+			:_read(0),_write(0),_error(false)
 		{
-			return _array.end();
+			const uint32_t max_size = (uint32_t)1 << 31;
+			capacity = capacity < max_size ? capacity : max_size;
+			uint32_t size = 1;
+			while(size < capacity)
+				size <<= 1;
+			_ring.resize(size);
+			_mask = size - 1;
 		}
-		reverse_iterator rbegin()
+		//contiguous free space to receive into, n returns its length
+		char* write_space(uint32_t& n)
 		{
-			return _array.rbegin();
+			uint32_t pos = _write & _mask;
+			uint32_t free_len = _ring.size() - (_write - _read);
+			uint32_t tail_len = _ring.size() - pos;
+			n = free_len < tail_len ? free_len : tail_len;
+			return &_ring[pos];
 		}
-		reverse_iterator rend()
+		void commit_write(uint32_t n)
 		{
-			return _array.rend();
+			BINPROTO_ASSERT(n <= _ring.size() - (_write - _read),"ring_frame_decoder commit more than free space");
+			_write += n;
 		}
-		const_reverse_iterator rbegin() const
+		//copies as much as fits, returns the bytes taken
+		uint32_t write(const char* data,uint32_t n)
 		{
-			return _array.rbegin();
+			uint32_t taken = 0;
+			while(taken < n)
+			{
+				uint32_t space;
+				char* dst = write_space(space);
+				if(space == 0)
+					break;
+				space = space < n - taken ? space : n - taken;
+				memcpy(dst,data + taken,space);
+				commit_write(space);
+				taken += space;
+			}
+			return taken;
 		}
-		const_reverse_iterator rend() const
+		bool next_frame(frame_view& frame)
 		{
-			return _array.rend();
+			uint32_t avail = _write - _read;
+			if(_error || avail < (uint32_t)frame_format_type::HEADER_LENGTH)
+				return false;
+			char header[frame_format_type::HEADER_LENGTH];
+			uint32_t body_len;
+			if(frame_format_type::parse_header(_peek(_read,frame_format_type::HEADER_LENGTH,header),frame_format_type::HEADER_LENGTH,body_len,frame.type_id) == 0
+				|| body_len > _ring.size() - frame_format_type::HEADER_LENGTH)
+			{
+				_error = true;
+				return false;
+			}
+			if(avail - frame_format_type::HEADER_LENGTH < body_len)
+				return false;
+			uint32_t body_pos = _read + frame_format_type::HEADER_LENGTH;
+			if(_linear.size() < body_len && ((body_pos & _mask) + body_len > _ring.size()))
+				_linear.resize(body_len);
+			frame.data = _peek(body_pos,body_len,_linear.empty() ? NULL : &_linear[0]);
+			frame.size = body_len;
+			_read = body_pos + body_len;
+			return true;
 		}
-		void push_back(const obj_type& _Val)
+		uint32_t size() const
 		{
-			_array.push_back(_Val);
-			BINPROTO_ASSERT(_array.size() <= BINPROTO_UINT_MAX_VALUE(typename list_size_type::uint_type),"list size must not larger than list_size_type max value");
+			return _write - _read;
 		}
-		void pop_back()
+		uint32_t capacity() const
 		{
-			_array.pop_back();
+			return _ring.size();
 		}
-		iterator erase(iterator _Where)
+		//a frame header announced a body larger than the ring or than uint32_t, the stream can not be decoded further
+		bool error() const
 		{
-			return _array.erase(_Where);
+			return _error;
 		}
-		iterator erase(iterator _First_arg, iterator _Last_arg)
+		void clear()
 		{
-			return _array.erase(_First_arg,_Last_arg);
+			_read = _write = 0;
+			_error = false;
 		}
-		obj_type& front()
+	private:
+		//pointer to n bytes at pos, copied into linear only when they wrap
+		const char* _peek(uint32_t pos,uint32_t n,char* linear) const
 		{
-			return _array.front();
+			uint32_t begin = pos & _mask;
+			uint32_t tail_len = _ring.size() - begin;
+			if(n <= tail_len)
+				return &_ring[begin];
+			memcpy(linear,&_ring[begin],tail_len);
+			memcpy(linear + tail_len,&_ring[0],n - tail_len);
+			return linear;
 		}
-		obj_type& back()
+	private:
+		std::vector<char> _ring;
+		std::vector<char> _linear;
+		uint32_t _mask;
+		uint32_t _read;
+		uint32_t _write;
+		bool _error;
+	};
+
+	//message id registry of a protocol, specialized by BINPROTO_DEFINE_MESSAGE_ID,
+	//protocol is any tag type, so several protocols can reuse the same ids.
+	template<typename protocol, int id>
+	struct message_type
+	{
+		enum{defined = 0};
+	};
+
+	//one reusable packet object per registered id in [lo,hi], split in halves to keep the template depth low
+	template<typename protocol, int lo, int hi, int is_leaf = (lo == hi), int defined = message_type<protocol,lo>::defined>
+	struct _message_storage
+		:public _message_storage<protocol,lo,(lo + hi) / 2>
+		,public _message_storage<protocol,(lo + hi) / 2 + 1,hi>
+	{
+	};
+	template<typename protocol, int id>
+	struct _message_storage<protocol,id,id,1,1>
+	{
+		typename message_type<protocol,id>::type packet;
+	};
+	template<typename protocol, int id>
+	struct _message_storage<protocol,id,id,1,0>
+	{
+	};
+
+	//dense jump table from message id to packet type,
+	//dispatch() parses the body into the reusable object of its type and calls handler.on_message(packet),
+	//there is no virtual call and no allocation besides what the packet fields need.
+	template<typename protocol, typename handler_type, int max_id>
+	class message_dispatcher
+	{
+	public:
+		explicit message_dispatcher(handler_type& handler)
+			:_handler(handler)
 		{
-			return _array.back();
+			_fill_table<0,max_id>(typename _binproto_bool_value_to_bool_type<max_id == 0>::type());
 		}
-		const obj_type&  front() const
+		//returns the parsed length, or 0 with status set when the id is unknown or the body is malformed,
+		//the status is reset first, so one status serves a whole stream of messages
+		uint32_t dispatch(uint32_t id,const char* buffer,uint32_t bufflen,parse_status& status)
 		{
-			return _array.front();
+			status.reset();
+			if(id > (uint32_t)max_id || _table[id] == NULL)
+				return status.fail(parse_status::invalid_data);
+			return _table[id](*this,buffer,bufflen,status);
 		}
-		const obj_type&  back() const
+		template<int id>
+		typename message_type<protocol,id>::type& packet()
 		{
-			return _array.back();
+			return static_cast<_message_storage<protocol,id,id>&>(_storage).packet;
 		}
-		obj_type& operator[](uint32_t _Pos)
+	private:
+		typedef uint32_t (*thunk_type)(message_dispatcher&,const char*,uint32_t,parse_status&);
+		template<int id>
+		static uint32_t _thunk(message_dispatcher& self,const char* buffer,uint32_t bufflen,parse_status& status)
 		{
-			return _array[_Pos];
+			typename message_type<protocol,id>::type& packet = self.template packet<id>();
+			uint32_t temp_len = packet.parse_from_buffer(buffer,bufflen,status);
+			if(status.ok())
+				self._handler.on_message(packet);
+			return temp_len;
 		}
-		const obj_type& operator[](uint32_t _Pos) const
+		template<int lo, int hi>
+		void _fill_table(_binproto_false)
 		{
-			return _array[_Pos];
+			_fill_table<lo,(lo + hi) / 2>(typename _binproto_bool_value_to_bool_type<lo == (lo + hi) / 2>::type());
+			_fill_table<(lo + hi) / 2 + 1,hi>(typename _binproto_bool_value_to_bool_type<(lo + hi) / 2 + 1 == hi>::type());
 		}
-		iterator insert(iterator _Where, const obj_type& _Val)
+		template<int lo, int hi>
+		void _fill_table(_binproto_true)
 		{
-			iterator it = _array.insert(_Where,_Val);
-			BINPROTO_ASSERT(_array.size() <= BINPROTO_UINT_MAX_VALUE(typename list_size_type::uint_type),"list size must not larger than list_size_type max value");
-			return it;
+			_table[lo] = _thunk_of<lo>(typename _binproto_bool_value_to_bool_type<message_type<protocol,lo>::defined>::type());
 		}
-		uint32_t size() const
+		template<int id>
+		static thunk_type _thunk_of(_binproto_true)
 		{
-			return _array.size();
+			return &_thunk<id>;
 		}
-		void clear()
+		template<int id>
+		static thunk_type _thunk_of(_binproto_false)
 		{
-			_array.clear();
+			return NULL;
 		}
-		binary_obj_list& operator=(const binary_obj_list& other)
+	private:
+		handler_type& _handler;
+		thunk_type _table[max_id + 1];
+		_message_storage<protocol,0,max_id> _storage;
+	};
+
+	//pools of serialize_batch, a pool has
+	//	uint32_t concurrency() const	how many tasks may run at once
+	//	void run(uint32_t task_count,task_type& task)	calls task(i) once for every i in [0,task_count), in any order
+	//	and on any thread, and returns after the last call returned.
+	//any thread pool can be adapted to this in a few lines.
+
+	//runs every task on the calling thread
+	class inline_pool
+	{
+	public:
+		uint32_t concurrency() const
 		{
-			_array = other._array;
+			return 1;
 		}
-		void swap(binary_obj_list& other)
+		template<typename task_type>
+		void run(uint32_t task_count,task_type& task)
 		{
-			_array.swap(other._array);
+			for(uint32_t i = 0; i < task_count; i++)
+				task(i);
 		}
-		list_size_type get_size_obj() const
+	};
+
+#ifdef _BINPROTO_THREADS
+	//fixed set of worker threads, the thread calling run() works too, so threads 0 means hardware_concurrency() in all.
+	//workers take task indexes from a shared counter, a slow task does not hold up the others.
+	//run() may be called by one thread at a time.
+	class thread_pool
+	{
+	public:
+		explicit thread_pool(uint32_t threads = 0)
+			:_task(NULL),_call(NULL),_task_count(0),_next(0),_generation(0),_active(0),_stop(false)
 		{
-			return list_size_type(size());
+			if(threads == 0)
+				threads = std::thread::hardware_concurrency();
+			for(uint32_t i = 1; i < threads; i++)
+				_workers.push_back(std::thread(&thread_pool::_worker_loop,this));
 		}
-	public:
-		uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const 
+		~thread_pool()
 		{
-			uint32_t temp_len = 0;
-			BINPROTO_ASSERT(list_len_size <= bufflen,"binary_obj_list length serialize error");
-			temp_len += get_size_obj().serialize_to_buffer(buffer, bufflen);
-			uint32_t s = size();
-			for(uint32_t i = 0; i < s; i++)
 			{
-				temp_len += _array[i].serialize_to_buffer(buffer+temp_len, bufflen-temp_len);
+				std::lock_guard<std::mutex> lock(_mutex);
+				_stop = true;
 			}
-			return temp_len;
+			_wake.notify_all();
+			for(size_t i = 0; i < _workers.size(); i++)
+				_workers[i].join();
 		}
-		uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) throw(exception)
+		uint32_t concurrency() const
 		{
-			clear();
-			uint32_t temp_len = 0;
-			list_size_type temp;
-			_BINPROTO_PARSE_ENSURE(list_len_size <= bufflen,"binary_obj_list length parse error");
-			temp_len += temp.parse_from_buffer(buffer, bufflen);
-
-			_BINPROTO_PARSE_TRY;
-			_array.resize(temp.to_int());
-			for(uint32_t i = 0; i < temp.to_int(); i++)
+			return (uint32_t)_workers.size() + 1;
+		}
+		template<typename task_type>
+		void run(uint32_t task_count,task_type& task)
+		{
+			if(task_count <= 1 || _workers.empty())
 			{
-				temp_len += _array[i].parse_from_buffer(buffer + temp_len, bufflen - temp_len);
+				for(uint32_t i = 0; i < task_count; i++)
+					task(i);
+				return;
 			}
-			return temp_len;
-			_BINPROTO_PARSE_CATCH("binary_obj_list");
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_task = &task;
+				_call = &_call_task<task_type>;
+				_task_count = task_count;
+				_next.store(0);
+				_active = (uint32_t)_workers.size();
+				++_generation;
+			}
+			_wake.notify_all();
+			_work();
+			std::unique_lock<std::mutex> lock(_mutex);
+			while(_active != 0)
+				_done.wait(lock);
 		}
-		BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER
-		uint32_t get_binary_len() const
+	private:
+		template<typename task_type>
+		static void _call_task(void* task,uint32_t i)
 		{
-			return _get_binary_len_is_static(typename _binproto_bool_value_to_bool_type<obj_type::STATIC_BINARY_LENGTH != 0>::type());
+			(*static_cast<task_type*>(task))(i);
 		}
-	private:
-		uint32_t _get_binary_len_is_static(_binproto_true) const
+		void _work()
 		{
-			size_t iLength = list_size_type::STATIC_BINARY_LENGTH;
-			iLength += obj_type::STATIC_BINARY_LENGTH * size();
-			return iLength;
+			for(uint32_t i = _next.fetch_add(1); i < _task_count; i = _next.fetch_add(1))
+				_call(_task,i);
 		}
-		uint32_t _get_binary_len_is_static(_binproto_false) const
+		void _worker_loop()
 		{
-			size_t iLength = list_size_type::STATIC_BINARY_LENGTH;
-
-			uint32_t s = size();
-			for(uint32_t i = 0; i < s; i++)
+			uint64_t seen = 0;
+			for(;;)
 			{
-				iLength += _array[i].get_binary_len();
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					while(!_stop && _generation == seen)
+						_wake.wait(lock);
+					if(_stop)
+						return;
+					seen = _generation;
+				}
+				_work();
+				std::lock_guard<std::mutex> lock(_mutex);
+				if(--_active == 0)
+					_done.notify_one();
 			}
-
-			return iLength;
 		}
 	private:
-		container _array;
+		thread_pool(const thread_pool&);
+		thread_pool& operator=(const thread_pool&);
+	private:
+		std::vector<std::thread> _workers;
+		std::mutex _mutex;
+		std::condition_variable _wake;
+		std::condition_variable _done;
+		void* _task;
+		void (*_call)(void*,uint32_t);
+		uint32_t _task_count;
+		std::atomic<uint32_t> _next;
+		uint64_t _generation;
+		uint32_t _active;
+		bool _stop;
+	};
+#endif
+
+	//the two passes of serialize_batch over slices of the range,
+	//the first sums the binary length of each slice, the second serializes a slice from its offset.
+	//lengths are summed in 64 bits, the second pass only runs when the total fits uint32_t.
+	template<typename iterator_type>
+	struct _batch_task
+	{
+		enum{MIN_SLICE = 256};
+		iterator_type first;
+		uint32_t count;
+		uint32_t slice_count;
+		std::vector<uint64_t> offsets;
+		char* buffer;
+
+		uint32_t begin_of(uint32_t slice) const
+		{
+			return (uint32_t)((uint64_t)count * slice / slice_count);
+		}
+		void operator()(uint32_t slice)
+		{
+			iterator_type it = first + begin_of(slice);
+			iterator_type end = first + begin_of(slice + 1);
+			if(buffer == NULL)
+			{
+				uint64_t temp_len = 0;
+				for(; it != end; ++it)
+					temp_len += it->get_binary_len();
+				offsets[slice + 1] = temp_len;
+				return;
+			}
+			char* cur = buffer + offsets[slice];
+			uint32_t left = (uint32_t)(offsets[slice + 1] - offsets[slice]);
+			for(; it != end; ++it)
+			{
+				uint32_t temp_len = it->serialize_to_buffer(cur,left);
+				cur += temp_len;
+				left -= temp_len;
+			}
+		}
 	};
 
+	//four slices per pool thread for balance, each of at least MIN_SLICE packets, returns the total length
+	template<typename iterator_type, typename pool_type>
+	uint64_t _batch_prepare(_batch_task<iterator_type>& task,iterator_type first,iterator_type last,pool_type& pool)
+	{
+		uint32_t count = (uint32_t)(last - first);
+		uint32_t slice_count = pool.concurrency() * 4;
+		if(slice_count > count / _batch_task<iterator_type>::MIN_SLICE)
+			slice_count = count / _batch_task<iterator_type>::MIN_SLICE;
+		if(slice_count == 0)
+			slice_count = 1;
+		task.first = first;
+		task.count = count;
+		task.slice_count = slice_count;
+		task.offsets.assign(slice_count + 1,0);
+		task.buffer = NULL;
+		pool.run(slice_count,task);
+		for(uint32_t i = 0; i < slice_count; i++)
+			task.offsets[i + 1] += task.offsets[i];
+		BINPROTO_ASSERT(task.offsets[slice_count] <= UINT32_MAX,"serialize_batch total len must not larger than uint32_t max value");
+		return task.offsets[slice_count];
+	}
+
+	//serializes the packets of the random access range [first,last) back to back, the same bytes as
+	//serializing them one after another. the range is split into a few slices per pool thread,
+	//the slice lengths are summed in parallel and prefix summed into offsets,
+	//then every slice is serialized in parallel straight to its offset.
+	//returns the total length, nothing is written when it is larger than bufflen.
+	//a total larger than uint32_t asserts, with asserts off nothing is written and UINT32_MAX is returned.
+	template<typename iterator_type, typename pool_type>
+	uint32_t serialize_batch(iterator_type first,iterator_type last,char* buffer,uint32_t bufflen,pool_type& pool)
+	{
+		_batch_task<iterator_type> task;
+		uint64_t total_len = _batch_prepare(task,first,last,pool);
+		if(total_len > UINT32_MAX)
+			return UINT32_MAX;
+		if(total_len > bufflen || total_len == 0)
+			return (uint32_t)total_len;
+		task.buffer = buffer;
+		pool.run(task.slice_count,task);
+		return (uint32_t)total_len;
+	}
+	//replaces the content of vecbuff, which is left empty when the total is larger than uint32_t
+	template<typename iterator_type, typename pool_type>
+	uint32_t serialize_batch(iterator_type first,iterator_type last,std::vector<char>& vecbuff,pool_type& pool)
+	{
+		_batch_task<iterator_type> task;
+		uint64_t total_len = _batch_prepare(task,first,last,pool);
+		if(total_len > UINT32_MAX)
+		{
+			vecbuff.clear();
+			return UINT32_MAX;
+		}
+		vecbuff.resize((size_t)total_len);
+		if(total_len == 0)
+			return 0;
+		task.buffer = &vecbuff[0];
+		pool.run(task.slice_count,task);
+		return (uint32_t)total_len;
+	}
 	struct base_packet
 	{
-		virtual uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) throw(binproto::exception) = 0;
+		virtual uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC = 0;
 		virtual uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const = 0;
-		virtual uint32_t parse_from_buffer(const std::string& strbuff) throw(binproto::exception) = 0;
+		virtual uint32_t parse_from_buffer(const std::string& strbuff) BINPROTO_THROW_SPEC = 0;
 		virtual uint32_t serialize_to_buffer(std::string& strbuff) const = 0;
 		virtual uint32_t get_binary_len() const = 0;
 	};
 }
 
+//string fields are viewed without copy
+template<int len_size, typename alloc_type>
+struct _binproto_view_traits<binproto::variable_len_string<len_size,alloc_type>,0>
+	:public _binproto_view_traits<binproto::variable_len_string_view<len_size> >
+{
+};
+template<int str_len>
+struct _binproto_view_traits<binproto::fixed_len_string<str_len>,0>
+	:public _binproto_view_traits<binproto::fixed_len_string_view<str_len> >
+{
+};
+
+//register packet_type as message id of protocol, use it at global scope
+#define BINPROTO_DEFINE_MESSAGE_ID(protocol,id,packet_type) \
+	namespace binproto{ \
+	template<> struct message_type<protocol,id>{enum{defined = 1}; typedef packet_type type;}; \
+	}
+
 //macro defination
-#define _BINPROTO_FUNCTION_PARSE_START uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) throw(binproto::exception) {uint32_t temp_len = 0;
-#define _BINPROTO_FUNCTION_PARSE(object) temp_len += (object).parse_from_buffer(buffer + temp_len, bufflen - temp_len);
+//all-static packets are parsed and serialized at constant offsets with constant lengths, so the field bounds checks fold away.
+//the callers check the whole length once, and a static field never fails on a buffer that is long enough.
+//a short buffer takes the field by field path, which reports the failing field.
+#define _BINPROTO_FUNCTION_STATIC_START void _parse_static(const char* buffer){
+#define _BINPROTO_FUNCTION_PARSE_STATIC(index,prev,object) (object).parse_from_buffer(buffer + _binproto_static_end##prev, _binproto_field_type##index::STATIC_BINARY_LENGTH);
+#define _BINPROTO_FUNCTION_STATIC_MIDDLE } void _serialize_static(char* buffer) const{
+#define _BINPROTO_FUNCTION_SERIALIZE_STATIC(index,prev,object) (object).serialize_to_buffer(buffer + _binproto_static_end##prev, _binproto_field_type##index::STATIC_BINARY_LENGTH);
+#define _BINPROTO_FUNCTION_STATIC_END }
+
+//optional fields, a packet with optional_obj fields starts with a presence bitmap of one bit per optional field,
+//from the most significant bit of the first byte, and an absent field takes no bytes.
+//packets without optional fields have no bitmap and the checks below fold away.
+#define _BINPROTO_OPTIONAL(index) binproto::_optional_traits<_binproto_field_type##index>
+#define _BINPROTO_PRESENCE_BIT(presence,prev) (((presence)[_binproto_optional_count##prev / 8] >> (7 - _binproto_optional_count##prev % 8)) & 1)
+#define _BINPROTO_DEFINE_PRESENCE_START enum{_binproto_optional_count00 = 0};
+#define _BINPROTO_DEFINE_PRESENCE(index,prev) enum{_binproto_optional_count##index = _binproto_optional_count##prev + (int)_BINPROTO_OPTIONAL(index)::is_optional};
+#define _BINPROTO_DEFINE_PRESENCE_END(last) enum{_binproto_presence_len = (_binproto_optional_count##last + 7) / 8};
+#define _BINPROTO_FUNCTION_PRESENCE_START void _apply_presence(const char* presence){
+#define _BINPROTO_FUNCTION_APPLY_PRESENCE(index,prev,object) \
+	if(_BINPROTO_OPTIONAL(index)::is_optional){ \
+		if(_BINPROTO_PRESENCE_BIT(presence,prev)){_BINPROTO_OPTIONAL(index)::emplace(object);} \
+		else{_BINPROTO_OPTIONAL(index)::reset(object);}}
+#define _BINPROTO_FUNCTION_PRESENCE_MIDDLE } void _write_presence(char* presence) const{memset(presence,0,_binproto_presence_len);
+#define _BINPROTO_FUNCTION_WRITE_PRESENCE(index,prev,object) \
+	if(_BINPROTO_OPTIONAL(index)::is_optional && _BINPROTO_OPTIONAL(index)::present(object)){ \
+		presence[_binproto_optional_count##prev / 8] |= (char)(0x80 >> (_binproto_optional_count##prev % 8));}
+#define _BINPROTO_FUNCTION_PRESENCE_END }
+
+#define _BINPROTO_FUNCTION_PARSE_START uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC { \
+	if(STATIC_BINARY_LENGTH != 0 && bufflen >= STATIC_BINARY_LENGTH){_parse_static(buffer); return STATIC_BINARY_LENGTH;} \
+	uint32_t temp_len = 0;
+#define _BINPROTO_FUNCTION_PARSE_PRESENCE if(_binproto_presence_len != 0){ \
+	if(bufflen < _binproto_presence_len){BINPROTO_THROW("presence bitmap parse error");} \
+	_apply_presence(buffer); \
+	temp_len = _binproto_presence_len;}
+#define _BINPROTO_FUNCTION_PARSE(index,object) if(_BINPROTO_OPTIONAL(index)::present(object)){ \
+	temp_len += _BINPROTO_OPTIONAL(index)::payload(object).parse_from_buffer(buffer + temp_len, bufflen - temp_len);}
 #define _BINPROTO_FUNCTION_PARSE_END return temp_len;}
 
-#define _BINPROTO_FUNCTION_SERIALIZE_START uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const {uint32_t temp_len = 0;
-#define _BINPROTO_FUNCTION_SERIALIZE(object) temp_len += (object).serialize_to_buffer(buffer + temp_len, bufflen - temp_len);
+#define _BINPROTO_FUNCTION_STATUS_PARSE_START uint32_t parse_from_buffer(const char* buffer,uint32_t bufflen,binproto::parse_status& status) { \
+	status.reset(); \
+	if(STATIC_BINARY_LENGTH != 0 && bufflen >= STATIC_BINARY_LENGTH){_parse_static(buffer); return STATIC_BINARY_LENGTH;} \
+	uint32_t temp_len = 0;
+#define _BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) if(_binproto_presence_len != 0){ \
+	if(bufflen < _binproto_presence_len){status.fail(binproto::parse_status::short_buffer); return status.fail_at(0,#classname,"presence bitmap");} \
+	_apply_presence(buffer); \
+	temp_len = _binproto_presence_len;}
+#define _BINPROTO_FUNCTION_STATUS_PARSE(classname,index,object) if(_BINPROTO_OPTIONAL(index)::present(object)){ \
+	uint32_t field_len = _BINPROTO_OPTIONAL(index)::payload(object).parse_from_buffer(buffer + temp_len, bufflen - temp_len, status); \
+	if(!status.ok()){return status.fail_at(temp_len,#classname,#object);} \
+	temp_len += field_len;}
+#define _BINPROTO_FUNCTION_STATUS_PARSE_END return temp_len;}
+
+//resumable parse, the frame step holds the count of complete fields and the switch jumps back to the next one,
+//the presence bitmap is gathered in the frame before the first field.
+#define _BINPROTO_FIELD_NO(index) (1##index - 100)
+#define _BINPROTO_FUNCTION_PARSE_SOME_START bool parse_some(const char*& buffer,uint32_t& bufflen,binproto::parse_cursor& cursor,uint32_t depth){ \
+	switch(cursor.at(depth).step){ \
+	case 0: \
+	if(_binproto_presence_len != 0){ \
+		binproto::parse_cursor::frame& frame = cursor.at(depth); \
+		uint32_t n = _binproto_presence_len - frame.partial_len; \
+		n = n < bufflen ? n : bufflen; \
+		memcpy(frame.partial + frame.partial_len,buffer,n); \
+		frame.partial_len += n; \
+		buffer += n; \
+		bufflen -= n; \
+		if(frame.partial_len < _binproto_presence_len){return false;} \
+		_apply_presence(frame.partial);}
+#define _BINPROTO_FUNCTION_PARSE_SOME(index,object) \
+	if(_BINPROTO_OPTIONAL(index)::present(object) && !_BINPROTO_OPTIONAL(index)::payload(object).parse_some(buffer,bufflen,cursor,depth + 1)){return false;} \
+	cursor.reset(depth + 1); \
+	cursor.at(depth).step = _BINPROTO_FIELD_NO(index); \
+	_BINPROTO_FALLTHROUGH; \
+	case _BINPROTO_FIELD_NO(index):
+#define _BINPROTO_FUNCTION_PARSE_SOME_END ;} return true;}
+
+#define _BINPROTO_FUNCTION_SERIALIZE_START uint32_t serialize_to_buffer(char* buffer,uint32_t bufflen) const { \
+	if(STATIC_BINARY_LENGTH != 0 && bufflen >= STATIC_BINARY_LENGTH){_serialize_static(buffer); return STATIC_BINARY_LENGTH;} \
+	uint32_t temp_len = 0; \
+	if(_binproto_presence_len != 0){ \
+		BINPROTO_ASSERT(bufflen >= _binproto_presence_len,"presence bitmap serialize error"); \
+		_write_presence(buffer); \
+		temp_len = _binproto_presence_len;}
+#define _BINPROTO_FUNCTION_SERIALIZE(index,object) if(_BINPROTO_OPTIONAL(index)::present(object)){ \
+	temp_len += _BINPROTO_OPTIONAL(index)::payload(object).serialize_to_buffer(buffer + temp_len, bufflen - temp_len);}
 #define _BINPROTO_FUNCTION_SERIALIZE_END return temp_len;}
 
+#define _BINPROTO_FUNCTION_SINK_START template<typename sink_type> uint32_t serialize_to_sink(sink_type& sink) const { \
+	if(STATIC_BINARY_LENGTH != 0){serialize_to_buffer(sink.reserve(STATIC_BINARY_LENGTH),STATIC_BINARY_LENGTH); sink.commit(STATIC_BINARY_LENGTH); return STATIC_BINARY_LENGTH;} \
+	uint32_t temp_len = 0; \
+	if(_binproto_presence_len != 0){ \
+		_write_presence(sink.reserve(_binproto_presence_len)); \
+		sink.commit(_binproto_presence_len); \
+		temp_len = _binproto_presence_len;}
+#define _BINPROTO_FUNCTION_SINK(index,object) if(_BINPROTO_OPTIONAL(index)::present(object)){ \
+	temp_len += _BINPROTO_OPTIONAL(index)::payload(object).serialize_to_sink(sink);}
+#define _BINPROTO_FUNCTION_SINK_END return temp_len;}
+
 #define _BINPROTO_FUNCTION_GETLEN_START \
 	uint32_t get_binary_len() const{return _get_binary_len_is_static(_binproto_bool_value_to_bool_type<STATIC_BINARY_LENGTH != 0>::type());} \
 	uint32_t _get_binary_len_is_static(_binproto_true) const{return STATIC_BINARY_LENGTH;} \
-	uint32_t _get_binary_len_is_static(_binproto_false) const{uint32_t temp_len = 0;
-#define _BINPROTO_FUNCTION_GETLEN(object) temp_len += (object).get_binary_len();
+	uint32_t _get_binary_len_is_static(_binproto_false) const{uint32_t temp_len = _binproto_presence_len;
+#define _BINPROTO_FUNCTION_GETLEN(index,object) if(_BINPROTO_OPTIONAL(index)::present(object)){ \
+	temp_len += _BINPROTO_OPTIONAL(index)::payload(object).get_binary_len();}
 #define _BINPROTO_FUNCTION_GETLEN_END return temp_len;}
 
+#define _BINPROTO_FUNCTION_SKIP_START(classname) static uint32_t skip_from_buffer(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC { \
+	if(STATIC_BINARY_LENGTH != 0){if(bufflen < STATIC_BINARY_LENGTH){BINPROTO_THROW(#classname " parse error");} return STATIC_BINARY_LENGTH;} \
+	if(bufflen < _binproto_presence_len){BINPROTO_THROW(#classname " parse error");} \
+	uint32_t temp_len = _binproto_presence_len;
+#define _BINPROTO_FUNCTION_SKIP(index,prev) if(!_BINPROTO_OPTIONAL(index)::is_optional || _BINPROTO_PRESENCE_BIT(buffer,prev)){ \
+	temp_len += _BINPROTO_OPTIONAL(index)::payload_type::skip_from_buffer(buffer + temp_len, bufflen - temp_len);}
+#define _BINPROTO_FUNCTION_SKIP_END return temp_len;}
+
+//validate_buffer returns the encoded length, or 0 when the buffer does not hold a whole valid object.
+//it never throws and never allocates, so it can drop malformed input before a full parse.
+//a packet without fields (P00) encodes to no bytes, so its 0 can not tell valid from invalid,
+//it holds no data to check, and skip_from_buffer and the parses of it succeed with length 0.
+#define _BINPROTO_FUNCTION_VALIDATE_START static uint32_t validate_buffer(const char* buffer,uint32_t bufflen){ \
+	if(STATIC_BINARY_LENGTH != 0){return bufflen >= STATIC_BINARY_LENGTH ? STATIC_BINARY_LENGTH : 0;} \
+	if(bufflen < _binproto_presence_len){return 0;} \
+	uint32_t temp_len = _binproto_presence_len;
+#define _BINPROTO_FUNCTION_VALIDATE(index,prev) if(!_BINPROTO_OPTIONAL(index)::is_optional || _BINPROTO_PRESENCE_BIT(buffer,prev)){ \
+	uint32_t field_len = _BINPROTO_OPTIONAL(index)::payload_type::validate_buffer(buffer + temp_len, bufflen - temp_len); \
+	if(field_len == 0){return 0;} \
+	temp_len += field_len;}
+#define _BINPROTO_FUNCTION_VALIDATE_END return temp_len;}
+
+//compile-time offsets of the all-static prefix of a packet, field types are typedefed as _binproto_field_typeXX
+#define _BINPROTO_DEFINE_FIELD_OFFSET_START enum{_binproto_all_static00 = 1,_binproto_static_end00 = 0};
+#define _BINPROTO_DEFINE_FIELD_OFFSET(index,prev) enum{ \
+	_binproto_all_static##index = _binproto_all_static##prev && (_binproto_field_type##index::STATIC_BINARY_LENGTH != 0), \
+	_binproto_static_end##index = _binproto_static_end##prev + _binproto_field_type##index::STATIC_BINARY_LENGTH};
+
+//a packet without fields leaves the parameters of its generated functions unused
+#define _BINPROTO_UNUSED(name) (void)(name);
+
+//lazy read-only view, a field is decoded only when its accessor is called,
+//offsets inside the all-static prefix are constants, others are found once by skipping and cached.
+//an optional field is returned as an optional_obj decoded from the buffer.
+#define _BINPROTO_VIEW_UNKNOWN_OFFSET 0xFFFFFFFF
+#define _BINPROTO_VIEW_DEFINE_START(classname) struct view{ \
+	view():_buffer(NULL),_bufflen(0){_reset_offsets();} \
+	view(const char* buffer,uint32_t bufflen):_buffer(buffer),_bufflen(bufflen){_reset_offsets();} \
+	const char* data() const{return _buffer;} \
+	uint32_t _field_end00() const{return _binproto_presence_len;} \
+	bool _present_bit(uint32_t bit) const BINPROTO_THROW_SPEC{ \
+		if(_bufflen < _binproto_presence_len){BINPROTO_THROW(#classname " view error");} \
+		return ((_buffer[bit / 8] >> (7 - bit % 8)) & 1) != 0;}
+#define _BINPROTO_VIEW_PRESENT(index,prev) (!_BINPROTO_OPTIONAL(index)::is_optional || _present_bit(_binproto_optional_count##prev))
+#define _BINPROTO_VIEW_FIELD(classname,index,prev,name) \
+	_BINPROTO_OPTIONAL(index)::view_type name() const BINPROTO_THROW_SPEC{ \
+		uint32_t begin = _field_end##prev(); \
+		if(begin > _bufflen){BINPROTO_THROW(#classname " view error");} \
+		return _BINPROTO_OPTIONAL(index)::make_view(_buffer + begin, _bufflen - begin, _BINPROTO_VIEW_PRESENT(index,prev));} \
+	uint32_t _field_end##index() const BINPROTO_THROW_SPEC{ \
+		if(_binproto_all_static##index){return (uint32_t)_binproto_presence_len + _binproto_static_end##index;} \
+		if(_end##index == _BINPROTO_VIEW_UNKNOWN_OFFSET){ \
+			uint32_t begin = _field_end##prev(); \
+			if(begin > _bufflen){BINPROTO_THROW(#classname " view error");} \
+			_end##index = begin; \
+			if(_BINPROTO_VIEW_PRESENT(index,prev)){ \
+				_end##index += _BINPROTO_OPTIONAL(index)::payload_type::skip_from_buffer(_buffer + begin, _bufflen - begin);}} \
+		return _end##index;} \
+	mutable uint32_t _end##index;
+#define _BINPROTO_VIEW_RESET_START void _reset_offsets(){
+#define _BINPROTO_VIEW_RESET(index) _end##index = _BINPROTO_VIEW_UNKNOWN_OFFSET;
+#define _BINPROTO_VIEW_RESET_END }
+#define _BINPROTO_VIEW_DEFINE_END(classname,last) \
+	uint32_t get_binary_len() const BINPROTO_THROW_SPEC{ \
+		uint32_t len = _field_end##last(); \
+		if(len > _bufflen){BINPROTO_THROW(#classname " view error");} \
+		return len;} \
+	private: const char* _buffer; uint32_t _bufflen; };
+
+//struct of arrays of a packet for columnar_obj_list, a column per field with the name of the field,
+//the column type is chosen by _column_traits, rows are parsed and serialized in the packet encoding.
+#define _BINPROTO_COLUMNS_DEFINE_START struct columns{
+#define _BINPROTO_COLUMN(index,name) binproto::_column_traits<_binproto_field_type##index>::type name;
+#define _BINPROTO_COLUMNS_CLEAR_START void clear(){
+#define _BINPROTO_COLUMN_CLEAR(name) name.clear();
+#define _BINPROTO_COLUMNS_RESERVE_START } void reserve(uint32_t rows){
+#define _BINPROTO_COLUMN_RESERVE(name) name.reserve(rows);
+#define _BINPROTO_COLUMNS_PUSH_START(classname) } void push_back(const classname& packet){
+#define _BINPROTO_COLUMN_PUSH(name) name.push_back(packet.name);
+#define _BINPROTO_COLUMNS_GET_START(classname) } void get(uint32_t row,classname& packet) const{
+#define _BINPROTO_COLUMN_GET(name) name.get(row,packet.name);
+#define _BINPROTO_COLUMNS_PARSE_START } uint32_t parse_row(const char* buffer,uint32_t bufflen) BINPROTO_THROW_SPEC{ \
+	uint32_t temp_len = 0; \
+	if(_binproto_presence_len != 0){ \
+		if(bufflen < _binproto_presence_len){BINPROTO_THROW("presence bitmap parse error");} \
+		temp_len = _binproto_presence_len;}
+#define _BINPROTO_COLUMN_PARSE(index,prev,name) \
+	temp_len += name.append(buffer + temp_len, bufflen - temp_len, !_BINPROTO_OPTIONAL(index)::is_optional || _BINPROTO_PRESENCE_BIT(buffer,prev));
+#define _BINPROTO_COLUMNS_SERIALIZE_START return temp_len;} uint32_t serialize_row(uint32_t row,char* buffer,uint32_t bufflen) const{ \
+	uint32_t temp_len = 0; \
+	if(_binproto_presence_len != 0){ \
+		BINPROTO_ASSERT(bufflen >= _binproto_presence_len,"presence bitmap serialize error"); \
+		memset(buffer,0,_binproto_presence_len); \
+		temp_len = _binproto_presence_len;}
+#define _BINPROTO_COLUMN_SERIALIZE(index,prev,name) \
+	if(_BINPROTO_OPTIONAL(index)::is_optional && name.present(row)){ \
+		buffer[_binproto_optional_count##prev / 8] |= (char)(0x80 >> (_binproto_optional_count##prev % 8));} \
+	temp_len += name.serialize(row, buffer + temp_len, bufflen - temp_len);
+#define _BINPROTO_COLUMNS_GETLEN_START return temp_len;} uint32_t row_binary_len(uint32_t row) const{ \
+	uint32_t temp_len = _binproto_presence_len;
+#define _BINPROTO_COLUMN_GETLEN(name) temp_len += name.binary_len(row);
+#define _BINPROTO_COLUMNS_DEFINE_END return temp_len;} };
+
 #define _BINPROTO_PACKET_DEFINE_START(classname) struct classname{
 #define _BINPROTO_PACKET_DEFINE_END };
 
@@ -808,14 +5630,61 @@ namespace binproto
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_START \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_MIDDLE \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE_END(00) \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_UNUSED(buffer) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_UNUSED(buffer) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_UNUSED(presence) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_UNUSED(buffer) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_UNUSED(buffer) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,00) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_UNUSED(rows) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_UNUSED(packet) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_UNUSED(row) _BINPROTO_UNUSED(packet) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_UNUSED(buffer) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_UNUSED(row) _BINPROTO_UNUSED(bufflen) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_UNUSED(row) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -826,18 +5695,76 @@ namespace binproto
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_MIDDLE \
 	+(type01::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE_END(01) \
 	type01 name01; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,01) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -850,22 +5777,102 @@ namespace binproto
 	+(type01::STATIC_BINARY_LENGTH) \
 	+(type02::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE_END(02) \
 	type01 name01; \
 	type02 name02; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,02) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -880,26 +5887,128 @@ namespace binproto
 	+(type02::STATIC_BINARY_LENGTH) \
 	+(type03::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE_END(03) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,03) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -916,30 +6025,154 @@ namespace binproto
 	+(type03::STATIC_BINARY_LENGTH) \
 	+(type04::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE_END(04) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
 	type04 name04; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,04) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -958,34 +6191,180 @@ namespace binproto
 	+(type04::STATIC_BINARY_LENGTH) \
 	+(type05::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE_END(05) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
 	type04 name04; \
 	type05 name05; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,05) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1006,38 +6385,206 @@ namespace binproto
 	+(type05::STATIC_BINARY_LENGTH) \
 	+(type06::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE_END(06) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
 	type04 name04; \
 	type05 name05; \
 	type06 name06; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,06) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1060,6 +6607,30 @@ namespace binproto
 	+(type06::STATIC_BINARY_LENGTH) \
 	+(type07::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE_END(07) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1067,35 +6638,201 @@ namespace binproto
 	type05 name05; \
 	type06 name06; \
 	type07 name07; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,07) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1120,6 +6857,33 @@ namespace binproto
 	+(type07::STATIC_BINARY_LENGTH) \
 	+(type08::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE_END(08) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1128,38 +6892,223 @@ namespace binproto
 	type06 name06; \
 	type07 name07; \
 	type08 name08; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,08) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1186,6 +7135,36 @@ namespace binproto
 	+(type08::STATIC_BINARY_LENGTH) \
 	+(type09::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE_END(09) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1195,41 +7174,245 @@ namespace binproto
 	type07 name07; \
 	type08 name08; \
 	type09 name09; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,09) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1258,6 +7441,39 @@ namespace binproto
 	+(type09::STATIC_BINARY_LENGTH) \
 	+(type10::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE_END(10) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1268,44 +7484,267 @@ namespace binproto
 	type08 name08; \
 	type09 name09; \
 	type10 name10; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,10) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1336,6 +7775,42 @@ namespace binproto
 	+(type10::STATIC_BINARY_LENGTH) \
 	+(type11::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE_END(11) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1347,47 +7822,289 @@ namespace binproto
 	type09 name09; \
 	type10 name10; \
 	type11 name11; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,11) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1420,6 +8137,45 @@ namespace binproto
 	+(type11::STATIC_BINARY_LENGTH) \
 	+(type12::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	typedef type12 _binproto_field_type12; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(12,11) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE(12,11) \
+	_BINPROTO_DEFINE_PRESENCE_END(12) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1432,50 +8188,311 @@ namespace binproto
 	type10 name10; \
 	type11 name11; \
 	type12 name12; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
-	_BINPROTO_FUNCTION_PARSE(name12) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
+	_BINPROTO_FUNCTION_PARSE(12,name12) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,12,name12) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME(12,name12) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
-	_BINPROTO_FUNCTION_SERIALIZE(name12) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(12,name12) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK(12,name12) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
-	_BINPROTO_FUNCTION_GETLEN(name12) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
+	_BINPROTO_FUNCTION_GETLEN(12,name12) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_FUNCTION_SKIP(12,11) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE(12,11) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_FIELD(classname,12,11,name12) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET(12) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,12) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMN(12,name12) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMN_CLEAR(name12) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMN_RESERVE(name12) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMN_PUSH(name12) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMN_GET(name12) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMN_PARSE(12,11,name12) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMN_SERIALIZE(12,11,name12) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMN_GETLEN(name12) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1510,6 +8527,48 @@ namespace binproto
 	+(type12::STATIC_BINARY_LENGTH) \
 	+(type13::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	typedef type12 _binproto_field_type12; \
+	typedef type13 _binproto_field_type13; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(12,11) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(13,12) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE(12,11) \
+	_BINPROTO_DEFINE_PRESENCE(13,12) \
+	_BINPROTO_DEFINE_PRESENCE_END(13) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1523,53 +8582,333 @@ namespace binproto
 	type11 name11; \
 	type12 name12; \
 	type13 name13; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
-	_BINPROTO_FUNCTION_PARSE(name12) \
-	_BINPROTO_FUNCTION_PARSE(name13) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
+	_BINPROTO_FUNCTION_PARSE(12,name12) \
+	_BINPROTO_FUNCTION_PARSE(13,name13) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,12,name12) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,13,name13) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME(12,name12) \
+	_BINPROTO_FUNCTION_PARSE_SOME(13,name13) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
-	_BINPROTO_FUNCTION_SERIALIZE(name12) \
-	_BINPROTO_FUNCTION_SERIALIZE(name13) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(12,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE(13,name13) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK(12,name12) \
+	_BINPROTO_FUNCTION_SINK(13,name13) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
-	_BINPROTO_FUNCTION_GETLEN(name12) \
-	_BINPROTO_FUNCTION_GETLEN(name13) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
+	_BINPROTO_FUNCTION_GETLEN(12,name12) \
+	_BINPROTO_FUNCTION_GETLEN(13,name13) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_FUNCTION_SKIP(12,11) \
+	_BINPROTO_FUNCTION_SKIP(13,12) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE(12,11) \
+	_BINPROTO_FUNCTION_VALIDATE(13,12) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_FIELD(classname,12,11,name12) \
+	_BINPROTO_VIEW_FIELD(classname,13,12,name13) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET(12) \
+	_BINPROTO_VIEW_RESET(13) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,13) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMN(12,name12) \
+	_BINPROTO_COLUMN(13,name13) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMN_CLEAR(name12) \
+	_BINPROTO_COLUMN_CLEAR(name13) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMN_RESERVE(name12) \
+	_BINPROTO_COLUMN_RESERVE(name13) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMN_PUSH(name12) \
+	_BINPROTO_COLUMN_PUSH(name13) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMN_GET(name12) \
+	_BINPROTO_COLUMN_GET(name13) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMN_PARSE(12,11,name12) \
+	_BINPROTO_COLUMN_PARSE(13,12,name13) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMN_SERIALIZE(12,11,name12) \
+	_BINPROTO_COLUMN_SERIALIZE(13,12,name13) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMN_GETLEN(name12) \
+	_BINPROTO_COLUMN_GETLEN(name13) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1606,6 +8945,51 @@ namespace binproto
 	+(type13::STATIC_BINARY_LENGTH) \
 	+(type14::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	typedef type12 _binproto_field_type12; \
+	typedef type13 _binproto_field_type13; \
+	typedef type14 _binproto_field_type14; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(12,11) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(13,12) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(14,13) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE(12,11) \
+	_BINPROTO_DEFINE_PRESENCE(13,12) \
+	_BINPROTO_DEFINE_PRESENCE(14,13) \
+	_BINPROTO_DEFINE_PRESENCE_END(14) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1620,56 +9004,355 @@ namespace binproto
 	type12 name12; \
 	type13 name13; \
 	type14 name14; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
-	_BINPROTO_FUNCTION_PARSE(name12) \
-	_BINPROTO_FUNCTION_PARSE(name13) \
-	_BINPROTO_FUNCTION_PARSE(name14) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
+	_BINPROTO_FUNCTION_PARSE(12,name12) \
+	_BINPROTO_FUNCTION_PARSE(13,name13) \
+	_BINPROTO_FUNCTION_PARSE(14,name14) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,12,name12) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,13,name13) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,14,name14) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME(12,name12) \
+	_BINPROTO_FUNCTION_PARSE_SOME(13,name13) \
+	_BINPROTO_FUNCTION_PARSE_SOME(14,name14) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
-	_BINPROTO_FUNCTION_SERIALIZE(name12) \
-	_BINPROTO_FUNCTION_SERIALIZE(name13) \
-	_BINPROTO_FUNCTION_SERIALIZE(name14) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(12,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE(13,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE(14,name14) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK(12,name12) \
+	_BINPROTO_FUNCTION_SINK(13,name13) \
+	_BINPROTO_FUNCTION_SINK(14,name14) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
-	_BINPROTO_FUNCTION_GETLEN(name12) \
-	_BINPROTO_FUNCTION_GETLEN(name13) \
-	_BINPROTO_FUNCTION_GETLEN(name14) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
+	_BINPROTO_FUNCTION_GETLEN(12,name12) \
+	_BINPROTO_FUNCTION_GETLEN(13,name13) \
+	_BINPROTO_FUNCTION_GETLEN(14,name14) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_FUNCTION_SKIP(12,11) \
+	_BINPROTO_FUNCTION_SKIP(13,12) \
+	_BINPROTO_FUNCTION_SKIP(14,13) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE(12,11) \
+	_BINPROTO_FUNCTION_VALIDATE(13,12) \
+	_BINPROTO_FUNCTION_VALIDATE(14,13) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_FIELD(classname,12,11,name12) \
+	_BINPROTO_VIEW_FIELD(classname,13,12,name13) \
+	_BINPROTO_VIEW_FIELD(classname,14,13,name14) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET(12) \
+	_BINPROTO_VIEW_RESET(13) \
+	_BINPROTO_VIEW_RESET(14) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,14) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMN(12,name12) \
+	_BINPROTO_COLUMN(13,name13) \
+	_BINPROTO_COLUMN(14,name14) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMN_CLEAR(name12) \
+	_BINPROTO_COLUMN_CLEAR(name13) \
+	_BINPROTO_COLUMN_CLEAR(name14) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMN_RESERVE(name12) \
+	_BINPROTO_COLUMN_RESERVE(name13) \
+	_BINPROTO_COLUMN_RESERVE(name14) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMN_PUSH(name12) \
+	_BINPROTO_COLUMN_PUSH(name13) \
+	_BINPROTO_COLUMN_PUSH(name14) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMN_GET(name12) \
+	_BINPROTO_COLUMN_GET(name13) \
+	_BINPROTO_COLUMN_GET(name14) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMN_PARSE(12,11,name12) \
+	_BINPROTO_COLUMN_PARSE(13,12,name13) \
+	_BINPROTO_COLUMN_PARSE(14,13,name14) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMN_SERIALIZE(12,11,name12) \
+	_BINPROTO_COLUMN_SERIALIZE(13,12,name13) \
+	_BINPROTO_COLUMN_SERIALIZE(14,13,name14) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMN_GETLEN(name12) \
+	_BINPROTO_COLUMN_GETLEN(name13) \
+	_BINPROTO_COLUMN_GETLEN(name14) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1708,6 +9391,54 @@ namespace binproto
 	+(type14::STATIC_BINARY_LENGTH) \
 	+(type15::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	typedef type12 _binproto_field_type12; \
+	typedef type13 _binproto_field_type13; \
+	typedef type14 _binproto_field_type14; \
+	typedef type15 _binproto_field_type15; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(12,11) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(13,12) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(14,13) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(15,14) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE(12,11) \
+	_BINPROTO_DEFINE_PRESENCE(13,12) \
+	_BINPROTO_DEFINE_PRESENCE(14,13) \
+	_BINPROTO_DEFINE_PRESENCE(15,14) \
+	_BINPROTO_DEFINE_PRESENCE_END(15) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1723,59 +9454,377 @@ namespace binproto
 	type13 name13; \
 	type14 name14; \
 	type15 name15; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
-	_BINPROTO_FUNCTION_PARSE(name12) \
-	_BINPROTO_FUNCTION_PARSE(name13) \
-	_BINPROTO_FUNCTION_PARSE(name14) \
-	_BINPROTO_FUNCTION_PARSE(name15) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
+	_BINPROTO_FUNCTION_PARSE(12,name12) \
+	_BINPROTO_FUNCTION_PARSE(13,name13) \
+	_BINPROTO_FUNCTION_PARSE(14,name14) \
+	_BINPROTO_FUNCTION_PARSE(15,name15) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,12,name12) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,13,name13) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,14,name14) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,15,name15) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME(12,name12) \
+	_BINPROTO_FUNCTION_PARSE_SOME(13,name13) \
+	_BINPROTO_FUNCTION_PARSE_SOME(14,name14) \
+	_BINPROTO_FUNCTION_PARSE_SOME(15,name15) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
-	_BINPROTO_FUNCTION_SERIALIZE(name12) \
-	_BINPROTO_FUNCTION_SERIALIZE(name13) \
-	_BINPROTO_FUNCTION_SERIALIZE(name14) \
-	_BINPROTO_FUNCTION_SERIALIZE(name15) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(12,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE(13,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE(14,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE(15,name15) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK(12,name12) \
+	_BINPROTO_FUNCTION_SINK(13,name13) \
+	_BINPROTO_FUNCTION_SINK(14,name14) \
+	_BINPROTO_FUNCTION_SINK(15,name15) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
-	_BINPROTO_FUNCTION_GETLEN(name12) \
-	_BINPROTO_FUNCTION_GETLEN(name13) \
-	_BINPROTO_FUNCTION_GETLEN(name14) \
-	_BINPROTO_FUNCTION_GETLEN(name15) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
+	_BINPROTO_FUNCTION_GETLEN(12,name12) \
+	_BINPROTO_FUNCTION_GETLEN(13,name13) \
+	_BINPROTO_FUNCTION_GETLEN(14,name14) \
+	_BINPROTO_FUNCTION_GETLEN(15,name15) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_FUNCTION_SKIP(12,11) \
+	_BINPROTO_FUNCTION_SKIP(13,12) \
+	_BINPROTO_FUNCTION_SKIP(14,13) \
+	_BINPROTO_FUNCTION_SKIP(15,14) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE(12,11) \
+	_BINPROTO_FUNCTION_VALIDATE(13,12) \
+	_BINPROTO_FUNCTION_VALIDATE(14,13) \
+	_BINPROTO_FUNCTION_VALIDATE(15,14) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_FIELD(classname,12,11,name12) \
+	_BINPROTO_VIEW_FIELD(classname,13,12,name13) \
+	_BINPROTO_VIEW_FIELD(classname,14,13,name14) \
+	_BINPROTO_VIEW_FIELD(classname,15,14,name15) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET(12) \
+	_BINPROTO_VIEW_RESET(13) \
+	_BINPROTO_VIEW_RESET(14) \
+	_BINPROTO_VIEW_RESET(15) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,15) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMN(12,name12) \
+	_BINPROTO_COLUMN(13,name13) \
+	_BINPROTO_COLUMN(14,name14) \
+	_BINPROTO_COLUMN(15,name15) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMN_CLEAR(name12) \
+	_BINPROTO_COLUMN_CLEAR(name13) \
+	_BINPROTO_COLUMN_CLEAR(name14) \
+	_BINPROTO_COLUMN_CLEAR(name15) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMN_RESERVE(name12) \
+	_BINPROTO_COLUMN_RESERVE(name13) \
+	_BINPROTO_COLUMN_RESERVE(name14) \
+	_BINPROTO_COLUMN_RESERVE(name15) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMN_PUSH(name12) \
+	_BINPROTO_COLUMN_PUSH(name13) \
+	_BINPROTO_COLUMN_PUSH(name14) \
+	_BINPROTO_COLUMN_PUSH(name15) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMN_GET(name12) \
+	_BINPROTO_COLUMN_GET(name13) \
+	_BINPROTO_COLUMN_GET(name14) \
+	_BINPROTO_COLUMN_GET(name15) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMN_PARSE(12,11,name12) \
+	_BINPROTO_COLUMN_PARSE(13,12,name13) \
+	_BINPROTO_COLUMN_PARSE(14,13,name14) \
+	_BINPROTO_COLUMN_PARSE(15,14,name15) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMN_SERIALIZE(12,11,name12) \
+	_BINPROTO_COLUMN_SERIALIZE(13,12,name13) \
+	_BINPROTO_COLUMN_SERIALIZE(14,13,name14) \
+	_BINPROTO_COLUMN_SERIALIZE(15,14,name15) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMN_GETLEN(name12) \
+	_BINPROTO_COLUMN_GETLEN(name13) \
+	_BINPROTO_COLUMN_GETLEN(name14) \
+	_BINPROTO_COLUMN_GETLEN(name15) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1816,6 +9865,57 @@ namespace binproto
 	+(type15::STATIC_BINARY_LENGTH) \
 	+(type16::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	typedef type12 _binproto_field_type12; \
+	typedef type13 _binproto_field_type13; \
+	typedef type14 _binproto_field_type14; \
+	typedef type15 _binproto_field_type15; \
+	typedef type16 _binproto_field_type16; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(12,11) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(13,12) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(14,13) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(15,14) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(16,15) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE(12,11) \
+	_BINPROTO_DEFINE_PRESENCE(13,12) \
+	_BINPROTO_DEFINE_PRESENCE(14,13) \
+	_BINPROTO_DEFINE_PRESENCE(15,14) \
+	_BINPROTO_DEFINE_PRESENCE(16,15) \
+	_BINPROTO_DEFINE_PRESENCE_END(16) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1832,62 +9932,399 @@ namespace binproto
 	type14 name14; \
 	type15 name15; \
 	type16 name16; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
-	_BINPROTO_FUNCTION_PARSE(name12) \
-	_BINPROTO_FUNCTION_PARSE(name13) \
-	_BINPROTO_FUNCTION_PARSE(name14) \
-	_BINPROTO_FUNCTION_PARSE(name15) \
-	_BINPROTO_FUNCTION_PARSE(name16) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
+	_BINPROTO_FUNCTION_PARSE(12,name12) \
+	_BINPROTO_FUNCTION_PARSE(13,name13) \
+	_BINPROTO_FUNCTION_PARSE(14,name14) \
+	_BINPROTO_FUNCTION_PARSE(15,name15) \
+	_BINPROTO_FUNCTION_PARSE(16,name16) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,12,name12) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,13,name13) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,14,name14) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,15,name15) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,16,name16) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME(12,name12) \
+	_BINPROTO_FUNCTION_PARSE_SOME(13,name13) \
+	_BINPROTO_FUNCTION_PARSE_SOME(14,name14) \
+	_BINPROTO_FUNCTION_PARSE_SOME(15,name15) \
+	_BINPROTO_FUNCTION_PARSE_SOME(16,name16) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
-	_BINPROTO_FUNCTION_SERIALIZE(name12) \
-	_BINPROTO_FUNCTION_SERIALIZE(name13) \
-	_BINPROTO_FUNCTION_SERIALIZE(name14) \
-	_BINPROTO_FUNCTION_SERIALIZE(name15) \
-	_BINPROTO_FUNCTION_SERIALIZE(name16) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(12,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE(13,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE(14,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE(15,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE(16,name16) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK(12,name12) \
+	_BINPROTO_FUNCTION_SINK(13,name13) \
+	_BINPROTO_FUNCTION_SINK(14,name14) \
+	_BINPROTO_FUNCTION_SINK(15,name15) \
+	_BINPROTO_FUNCTION_SINK(16,name16) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
-	_BINPROTO_FUNCTION_GETLEN(name12) \
-	_BINPROTO_FUNCTION_GETLEN(name13) \
-	_BINPROTO_FUNCTION_GETLEN(name14) \
-	_BINPROTO_FUNCTION_GETLEN(name15) \
-	_BINPROTO_FUNCTION_GETLEN(name16) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
+	_BINPROTO_FUNCTION_GETLEN(12,name12) \
+	_BINPROTO_FUNCTION_GETLEN(13,name13) \
+	_BINPROTO_FUNCTION_GETLEN(14,name14) \
+	_BINPROTO_FUNCTION_GETLEN(15,name15) \
+	_BINPROTO_FUNCTION_GETLEN(16,name16) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_FUNCTION_SKIP(12,11) \
+	_BINPROTO_FUNCTION_SKIP(13,12) \
+	_BINPROTO_FUNCTION_SKIP(14,13) \
+	_BINPROTO_FUNCTION_SKIP(15,14) \
+	_BINPROTO_FUNCTION_SKIP(16,15) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE(12,11) \
+	_BINPROTO_FUNCTION_VALIDATE(13,12) \
+	_BINPROTO_FUNCTION_VALIDATE(14,13) \
+	_BINPROTO_FUNCTION_VALIDATE(15,14) \
+	_BINPROTO_FUNCTION_VALIDATE(16,15) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_FIELD(classname,12,11,name12) \
+	_BINPROTO_VIEW_FIELD(classname,13,12,name13) \
+	_BINPROTO_VIEW_FIELD(classname,14,13,name14) \
+	_BINPROTO_VIEW_FIELD(classname,15,14,name15) \
+	_BINPROTO_VIEW_FIELD(classname,16,15,name16) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET(12) \
+	_BINPROTO_VIEW_RESET(13) \
+	_BINPROTO_VIEW_RESET(14) \
+	_BINPROTO_VIEW_RESET(15) \
+	_BINPROTO_VIEW_RESET(16) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,16) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMN(12,name12) \
+	_BINPROTO_COLUMN(13,name13) \
+	_BINPROTO_COLUMN(14,name14) \
+	_BINPROTO_COLUMN(15,name15) \
+	_BINPROTO_COLUMN(16,name16) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMN_CLEAR(name12) \
+	_BINPROTO_COLUMN_CLEAR(name13) \
+	_BINPROTO_COLUMN_CLEAR(name14) \
+	_BINPROTO_COLUMN_CLEAR(name15) \
+	_BINPROTO_COLUMN_CLEAR(name16) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMN_RESERVE(name12) \
+	_BINPROTO_COLUMN_RESERVE(name13) \
+	_BINPROTO_COLUMN_RESERVE(name14) \
+	_BINPROTO_COLUMN_RESERVE(name15) \
+	_BINPROTO_COLUMN_RESERVE(name16) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMN_PUSH(name12) \
+	_BINPROTO_COLUMN_PUSH(name13) \
+	_BINPROTO_COLUMN_PUSH(name14) \
+	_BINPROTO_COLUMN_PUSH(name15) \
+	_BINPROTO_COLUMN_PUSH(name16) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMN_GET(name12) \
+	_BINPROTO_COLUMN_GET(name13) \
+	_BINPROTO_COLUMN_GET(name14) \
+	_BINPROTO_COLUMN_GET(name15) \
+	_BINPROTO_COLUMN_GET(name16) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMN_PARSE(12,11,name12) \
+	_BINPROTO_COLUMN_PARSE(13,12,name13) \
+	_BINPROTO_COLUMN_PARSE(14,13,name14) \
+	_BINPROTO_COLUMN_PARSE(15,14,name15) \
+	_BINPROTO_COLUMN_PARSE(16,15,name16) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMN_SERIALIZE(12,11,name12) \
+	_BINPROTO_COLUMN_SERIALIZE(13,12,name13) \
+	_BINPROTO_COLUMN_SERIALIZE(14,13,name14) \
+	_BINPROTO_COLUMN_SERIALIZE(15,14,name15) \
+	_BINPROTO_COLUMN_SERIALIZE(16,15,name16) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMN_GETLEN(name12) \
+	_BINPROTO_COLUMN_GETLEN(name13) \
+	_BINPROTO_COLUMN_GETLEN(name14) \
+	_BINPROTO_COLUMN_GETLEN(name15) \
+	_BINPROTO_COLUMN_GETLEN(name16) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -1930,6 +10367,60 @@ namespace binproto
 	+(type16::STATIC_BINARY_LENGTH) \
 	+(type17::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	typedef type12 _binproto_field_type12; \
+	typedef type13 _binproto_field_type13; \
+	typedef type14 _binproto_field_type14; \
+	typedef type15 _binproto_field_type15; \
+	typedef type16 _binproto_field_type16; \
+	typedef type17 _binproto_field_type17; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(12,11) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(13,12) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(14,13) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(15,14) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(16,15) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(17,16) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE(12,11) \
+	_BINPROTO_DEFINE_PRESENCE(13,12) \
+	_BINPROTO_DEFINE_PRESENCE(14,13) \
+	_BINPROTO_DEFINE_PRESENCE(15,14) \
+	_BINPROTO_DEFINE_PRESENCE(16,15) \
+	_BINPROTO_DEFINE_PRESENCE(17,16) \
+	_BINPROTO_DEFINE_PRESENCE_END(17) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -1947,65 +10438,421 @@ namespace binproto
 	type15 name15; \
 	type16 name16; \
 	type17 name17; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(17,16,name17) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(17,16,name17) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(17,16,name17) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(17,16,name17) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
-	_BINPROTO_FUNCTION_PARSE(name12) \
-	_BINPROTO_FUNCTION_PARSE(name13) \
-	_BINPROTO_FUNCTION_PARSE(name14) \
-	_BINPROTO_FUNCTION_PARSE(name15) \
-	_BINPROTO_FUNCTION_PARSE(name16) \
-	_BINPROTO_FUNCTION_PARSE(name17) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
+	_BINPROTO_FUNCTION_PARSE(12,name12) \
+	_BINPROTO_FUNCTION_PARSE(13,name13) \
+	_BINPROTO_FUNCTION_PARSE(14,name14) \
+	_BINPROTO_FUNCTION_PARSE(15,name15) \
+	_BINPROTO_FUNCTION_PARSE(16,name16) \
+	_BINPROTO_FUNCTION_PARSE(17,name17) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,12,name12) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,13,name13) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,14,name14) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,15,name15) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,16,name16) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,17,name17) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME(12,name12) \
+	_BINPROTO_FUNCTION_PARSE_SOME(13,name13) \
+	_BINPROTO_FUNCTION_PARSE_SOME(14,name14) \
+	_BINPROTO_FUNCTION_PARSE_SOME(15,name15) \
+	_BINPROTO_FUNCTION_PARSE_SOME(16,name16) \
+	_BINPROTO_FUNCTION_PARSE_SOME(17,name17) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
-	_BINPROTO_FUNCTION_SERIALIZE(name12) \
-	_BINPROTO_FUNCTION_SERIALIZE(name13) \
-	_BINPROTO_FUNCTION_SERIALIZE(name14) \
-	_BINPROTO_FUNCTION_SERIALIZE(name15) \
-	_BINPROTO_FUNCTION_SERIALIZE(name16) \
-	_BINPROTO_FUNCTION_SERIALIZE(name17) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(12,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE(13,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE(14,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE(15,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE(16,name16) \
+	_BINPROTO_FUNCTION_SERIALIZE(17,name17) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK(12,name12) \
+	_BINPROTO_FUNCTION_SINK(13,name13) \
+	_BINPROTO_FUNCTION_SINK(14,name14) \
+	_BINPROTO_FUNCTION_SINK(15,name15) \
+	_BINPROTO_FUNCTION_SINK(16,name16) \
+	_BINPROTO_FUNCTION_SINK(17,name17) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
-	_BINPROTO_FUNCTION_GETLEN(name12) \
-	_BINPROTO_FUNCTION_GETLEN(name13) \
-	_BINPROTO_FUNCTION_GETLEN(name14) \
-	_BINPROTO_FUNCTION_GETLEN(name15) \
-	_BINPROTO_FUNCTION_GETLEN(name16) \
-	_BINPROTO_FUNCTION_GETLEN(name17) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
+	_BINPROTO_FUNCTION_GETLEN(12,name12) \
+	_BINPROTO_FUNCTION_GETLEN(13,name13) \
+	_BINPROTO_FUNCTION_GETLEN(14,name14) \
+	_BINPROTO_FUNCTION_GETLEN(15,name15) \
+	_BINPROTO_FUNCTION_GETLEN(16,name16) \
+	_BINPROTO_FUNCTION_GETLEN(17,name17) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_FUNCTION_SKIP(12,11) \
+	_BINPROTO_FUNCTION_SKIP(13,12) \
+	_BINPROTO_FUNCTION_SKIP(14,13) \
+	_BINPROTO_FUNCTION_SKIP(15,14) \
+	_BINPROTO_FUNCTION_SKIP(16,15) \
+	_BINPROTO_FUNCTION_SKIP(17,16) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE(12,11) \
+	_BINPROTO_FUNCTION_VALIDATE(13,12) \
+	_BINPROTO_FUNCTION_VALIDATE(14,13) \
+	_BINPROTO_FUNCTION_VALIDATE(15,14) \
+	_BINPROTO_FUNCTION_VALIDATE(16,15) \
+	_BINPROTO_FUNCTION_VALIDATE(17,16) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_FIELD(classname,12,11,name12) \
+	_BINPROTO_VIEW_FIELD(classname,13,12,name13) \
+	_BINPROTO_VIEW_FIELD(classname,14,13,name14) \
+	_BINPROTO_VIEW_FIELD(classname,15,14,name15) \
+	_BINPROTO_VIEW_FIELD(classname,16,15,name16) \
+	_BINPROTO_VIEW_FIELD(classname,17,16,name17) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET(12) \
+	_BINPROTO_VIEW_RESET(13) \
+	_BINPROTO_VIEW_RESET(14) \
+	_BINPROTO_VIEW_RESET(15) \
+	_BINPROTO_VIEW_RESET(16) \
+	_BINPROTO_VIEW_RESET(17) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,17) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMN(12,name12) \
+	_BINPROTO_COLUMN(13,name13) \
+	_BINPROTO_COLUMN(14,name14) \
+	_BINPROTO_COLUMN(15,name15) \
+	_BINPROTO_COLUMN(16,name16) \
+	_BINPROTO_COLUMN(17,name17) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMN_CLEAR(name12) \
+	_BINPROTO_COLUMN_CLEAR(name13) \
+	_BINPROTO_COLUMN_CLEAR(name14) \
+	_BINPROTO_COLUMN_CLEAR(name15) \
+	_BINPROTO_COLUMN_CLEAR(name16) \
+	_BINPROTO_COLUMN_CLEAR(name17) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMN_RESERVE(name12) \
+	_BINPROTO_COLUMN_RESERVE(name13) \
+	_BINPROTO_COLUMN_RESERVE(name14) \
+	_BINPROTO_COLUMN_RESERVE(name15) \
+	_BINPROTO_COLUMN_RESERVE(name16) \
+	_BINPROTO_COLUMN_RESERVE(name17) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMN_PUSH(name12) \
+	_BINPROTO_COLUMN_PUSH(name13) \
+	_BINPROTO_COLUMN_PUSH(name14) \
+	_BINPROTO_COLUMN_PUSH(name15) \
+	_BINPROTO_COLUMN_PUSH(name16) \
+	_BINPROTO_COLUMN_PUSH(name17) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMN_GET(name12) \
+	_BINPROTO_COLUMN_GET(name13) \
+	_BINPROTO_COLUMN_GET(name14) \
+	_BINPROTO_COLUMN_GET(name15) \
+	_BINPROTO_COLUMN_GET(name16) \
+	_BINPROTO_COLUMN_GET(name17) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMN_PARSE(12,11,name12) \
+	_BINPROTO_COLUMN_PARSE(13,12,name13) \
+	_BINPROTO_COLUMN_PARSE(14,13,name14) \
+	_BINPROTO_COLUMN_PARSE(15,14,name15) \
+	_BINPROTO_COLUMN_PARSE(16,15,name16) \
+	_BINPROTO_COLUMN_PARSE(17,16,name17) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMN_SERIALIZE(12,11,name12) \
+	_BINPROTO_COLUMN_SERIALIZE(13,12,name13) \
+	_BINPROTO_COLUMN_SERIALIZE(14,13,name14) \
+	_BINPROTO_COLUMN_SERIALIZE(15,14,name15) \
+	_BINPROTO_COLUMN_SERIALIZE(16,15,name16) \
+	_BINPROTO_COLUMN_SERIALIZE(17,16,name17) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMN_GETLEN(name12) \
+	_BINPROTO_COLUMN_GETLEN(name13) \
+	_BINPROTO_COLUMN_GETLEN(name14) \
+	_BINPROTO_COLUMN_GETLEN(name15) \
+	_BINPROTO_COLUMN_GETLEN(name16) \
+	_BINPROTO_COLUMN_GETLEN(name17) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -2050,6 +10897,63 @@ namespace binproto
 	+(type17::STATIC_BINARY_LENGTH) \
 	+(type18::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	typedef type12 _binproto_field_type12; \
+	typedef type13 _binproto_field_type13; \
+	typedef type14 _binproto_field_type14; \
+	typedef type15 _binproto_field_type15; \
+	typedef type16 _binproto_field_type16; \
+	typedef type17 _binproto_field_type17; \
+	typedef type18 _binproto_field_type18; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(12,11) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(13,12) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(14,13) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(15,14) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(16,15) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(17,16) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(18,17) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE(12,11) \
+	_BINPROTO_DEFINE_PRESENCE(13,12) \
+	_BINPROTO_DEFINE_PRESENCE(14,13) \
+	_BINPROTO_DEFINE_PRESENCE(15,14) \
+	_BINPROTO_DEFINE_PRESENCE(16,15) \
+	_BINPROTO_DEFINE_PRESENCE(17,16) \
+	_BINPROTO_DEFINE_PRESENCE(18,17) \
+	_BINPROTO_DEFINE_PRESENCE_END(18) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -2068,68 +10972,443 @@ namespace binproto
 	type16 name16; \
 	type17 name17; \
 	type18 name18; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(17,16,name17) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(18,17,name18) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(17,16,name17) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(18,17,name18) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(17,16,name17) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(18,17,name18) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(17,16,name17) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(18,17,name18) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
-	_BINPROTO_FUNCTION_PARSE(name12) \
-	_BINPROTO_FUNCTION_PARSE(name13) \
-	_BINPROTO_FUNCTION_PARSE(name14) \
-	_BINPROTO_FUNCTION_PARSE(name15) \
-	_BINPROTO_FUNCTION_PARSE(name16) \
-	_BINPROTO_FUNCTION_PARSE(name17) \
-	_BINPROTO_FUNCTION_PARSE(name18) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
+	_BINPROTO_FUNCTION_PARSE(12,name12) \
+	_BINPROTO_FUNCTION_PARSE(13,name13) \
+	_BINPROTO_FUNCTION_PARSE(14,name14) \
+	_BINPROTO_FUNCTION_PARSE(15,name15) \
+	_BINPROTO_FUNCTION_PARSE(16,name16) \
+	_BINPROTO_FUNCTION_PARSE(17,name17) \
+	_BINPROTO_FUNCTION_PARSE(18,name18) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,12,name12) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,13,name13) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,14,name14) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,15,name15) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,16,name16) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,17,name17) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,18,name18) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME(12,name12) \
+	_BINPROTO_FUNCTION_PARSE_SOME(13,name13) \
+	_BINPROTO_FUNCTION_PARSE_SOME(14,name14) \
+	_BINPROTO_FUNCTION_PARSE_SOME(15,name15) \
+	_BINPROTO_FUNCTION_PARSE_SOME(16,name16) \
+	_BINPROTO_FUNCTION_PARSE_SOME(17,name17) \
+	_BINPROTO_FUNCTION_PARSE_SOME(18,name18) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
-	_BINPROTO_FUNCTION_SERIALIZE(name12) \
-	_BINPROTO_FUNCTION_SERIALIZE(name13) \
-	_BINPROTO_FUNCTION_SERIALIZE(name14) \
-	_BINPROTO_FUNCTION_SERIALIZE(name15) \
-	_BINPROTO_FUNCTION_SERIALIZE(name16) \
-	_BINPROTO_FUNCTION_SERIALIZE(name17) \
-	_BINPROTO_FUNCTION_SERIALIZE(name18) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(12,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE(13,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE(14,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE(15,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE(16,name16) \
+	_BINPROTO_FUNCTION_SERIALIZE(17,name17) \
+	_BINPROTO_FUNCTION_SERIALIZE(18,name18) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK(12,name12) \
+	_BINPROTO_FUNCTION_SINK(13,name13) \
+	_BINPROTO_FUNCTION_SINK(14,name14) \
+	_BINPROTO_FUNCTION_SINK(15,name15) \
+	_BINPROTO_FUNCTION_SINK(16,name16) \
+	_BINPROTO_FUNCTION_SINK(17,name17) \
+	_BINPROTO_FUNCTION_SINK(18,name18) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
-	_BINPROTO_FUNCTION_GETLEN(name12) \
-	_BINPROTO_FUNCTION_GETLEN(name13) \
-	_BINPROTO_FUNCTION_GETLEN(name14) \
-	_BINPROTO_FUNCTION_GETLEN(name15) \
-	_BINPROTO_FUNCTION_GETLEN(name16) \
-	_BINPROTO_FUNCTION_GETLEN(name17) \
-	_BINPROTO_FUNCTION_GETLEN(name18) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
+	_BINPROTO_FUNCTION_GETLEN(12,name12) \
+	_BINPROTO_FUNCTION_GETLEN(13,name13) \
+	_BINPROTO_FUNCTION_GETLEN(14,name14) \
+	_BINPROTO_FUNCTION_GETLEN(15,name15) \
+	_BINPROTO_FUNCTION_GETLEN(16,name16) \
+	_BINPROTO_FUNCTION_GETLEN(17,name17) \
+	_BINPROTO_FUNCTION_GETLEN(18,name18) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_FUNCTION_SKIP(12,11) \
+	_BINPROTO_FUNCTION_SKIP(13,12) \
+	_BINPROTO_FUNCTION_SKIP(14,13) \
+	_BINPROTO_FUNCTION_SKIP(15,14) \
+	_BINPROTO_FUNCTION_SKIP(16,15) \
+	_BINPROTO_FUNCTION_SKIP(17,16) \
+	_BINPROTO_FUNCTION_SKIP(18,17) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE(12,11) \
+	_BINPROTO_FUNCTION_VALIDATE(13,12) \
+	_BINPROTO_FUNCTION_VALIDATE(14,13) \
+	_BINPROTO_FUNCTION_VALIDATE(15,14) \
+	_BINPROTO_FUNCTION_VALIDATE(16,15) \
+	_BINPROTO_FUNCTION_VALIDATE(17,16) \
+	_BINPROTO_FUNCTION_VALIDATE(18,17) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_FIELD(classname,12,11,name12) \
+	_BINPROTO_VIEW_FIELD(classname,13,12,name13) \
+	_BINPROTO_VIEW_FIELD(classname,14,13,name14) \
+	_BINPROTO_VIEW_FIELD(classname,15,14,name15) \
+	_BINPROTO_VIEW_FIELD(classname,16,15,name16) \
+	_BINPROTO_VIEW_FIELD(classname,17,16,name17) \
+	_BINPROTO_VIEW_FIELD(classname,18,17,name18) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET(12) \
+	_BINPROTO_VIEW_RESET(13) \
+	_BINPROTO_VIEW_RESET(14) \
+	_BINPROTO_VIEW_RESET(15) \
+	_BINPROTO_VIEW_RESET(16) \
+	_BINPROTO_VIEW_RESET(17) \
+	_BINPROTO_VIEW_RESET(18) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,18) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMN(12,name12) \
+	_BINPROTO_COLUMN(13,name13) \
+	_BINPROTO_COLUMN(14,name14) \
+	_BINPROTO_COLUMN(15,name15) \
+	_BINPROTO_COLUMN(16,name16) \
+	_BINPROTO_COLUMN(17,name17) \
+	_BINPROTO_COLUMN(18,name18) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMN_CLEAR(name12) \
+	_BINPROTO_COLUMN_CLEAR(name13) \
+	_BINPROTO_COLUMN_CLEAR(name14) \
+	_BINPROTO_COLUMN_CLEAR(name15) \
+	_BINPROTO_COLUMN_CLEAR(name16) \
+	_BINPROTO_COLUMN_CLEAR(name17) \
+	_BINPROTO_COLUMN_CLEAR(name18) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMN_RESERVE(name12) \
+	_BINPROTO_COLUMN_RESERVE(name13) \
+	_BINPROTO_COLUMN_RESERVE(name14) \
+	_BINPROTO_COLUMN_RESERVE(name15) \
+	_BINPROTO_COLUMN_RESERVE(name16) \
+	_BINPROTO_COLUMN_RESERVE(name17) \
+	_BINPROTO_COLUMN_RESERVE(name18) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMN_PUSH(name12) \
+	_BINPROTO_COLUMN_PUSH(name13) \
+	_BINPROTO_COLUMN_PUSH(name14) \
+	_BINPROTO_COLUMN_PUSH(name15) \
+	_BINPROTO_COLUMN_PUSH(name16) \
+	_BINPROTO_COLUMN_PUSH(name17) \
+	_BINPROTO_COLUMN_PUSH(name18) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMN_GET(name12) \
+	_BINPROTO_COLUMN_GET(name13) \
+	_BINPROTO_COLUMN_GET(name14) \
+	_BINPROTO_COLUMN_GET(name15) \
+	_BINPROTO_COLUMN_GET(name16) \
+	_BINPROTO_COLUMN_GET(name17) \
+	_BINPROTO_COLUMN_GET(name18) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMN_PARSE(12,11,name12) \
+	_BINPROTO_COLUMN_PARSE(13,12,name13) \
+	_BINPROTO_COLUMN_PARSE(14,13,name14) \
+	_BINPROTO_COLUMN_PARSE(15,14,name15) \
+	_BINPROTO_COLUMN_PARSE(16,15,name16) \
+	_BINPROTO_COLUMN_PARSE(17,16,name17) \
+	_BINPROTO_COLUMN_PARSE(18,17,name18) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMN_SERIALIZE(12,11,name12) \
+	_BINPROTO_COLUMN_SERIALIZE(13,12,name13) \
+	_BINPROTO_COLUMN_SERIALIZE(14,13,name14) \
+	_BINPROTO_COLUMN_SERIALIZE(15,14,name15) \
+	_BINPROTO_COLUMN_SERIALIZE(16,15,name16) \
+	_BINPROTO_COLUMN_SERIALIZE(17,16,name17) \
+	_BINPROTO_COLUMN_SERIALIZE(18,17,name18) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMN_GETLEN(name12) \
+	_BINPROTO_COLUMN_GETLEN(name13) \
+	_BINPROTO_COLUMN_GETLEN(name14) \
+	_BINPROTO_COLUMN_GETLEN(name15) \
+	_BINPROTO_COLUMN_GETLEN(name16) \
+	_BINPROTO_COLUMN_GETLEN(name17) \
+	_BINPROTO_COLUMN_GETLEN(name18) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -2176,6 +11455,66 @@ namespace binproto
 	+(type18::STATIC_BINARY_LENGTH) \
 	+(type19::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	typedef type12 _binproto_field_type12; \
+	typedef type13 _binproto_field_type13; \
+	typedef type14 _binproto_field_type14; \
+	typedef type15 _binproto_field_type15; \
+	typedef type16 _binproto_field_type16; \
+	typedef type17 _binproto_field_type17; \
+	typedef type18 _binproto_field_type18; \
+	typedef type19 _binproto_field_type19; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(12,11) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(13,12) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(14,13) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(15,14) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(16,15) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(17,16) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(18,17) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(19,18) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE(12,11) \
+	_BINPROTO_DEFINE_PRESENCE(13,12) \
+	_BINPROTO_DEFINE_PRESENCE(14,13) \
+	_BINPROTO_DEFINE_PRESENCE(15,14) \
+	_BINPROTO_DEFINE_PRESENCE(16,15) \
+	_BINPROTO_DEFINE_PRESENCE(17,16) \
+	_BINPROTO_DEFINE_PRESENCE(18,17) \
+	_BINPROTO_DEFINE_PRESENCE(19,18) \
+	_BINPROTO_DEFINE_PRESENCE_END(19) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -2195,71 +11534,465 @@ namespace binproto
 	type17 name17; \
 	type18 name18; \
 	type19 name19; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(17,16,name17) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(18,17,name18) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(19,18,name19) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(17,16,name17) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(18,17,name18) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(19,18,name19) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(17,16,name17) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(18,17,name18) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(19,18,name19) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(17,16,name17) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(18,17,name18) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(19,18,name19) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
-	_BINPROTO_FUNCTION_PARSE(name12) \
-	_BINPROTO_FUNCTION_PARSE(name13) \
-	_BINPROTO_FUNCTION_PARSE(name14) \
-	_BINPROTO_FUNCTION_PARSE(name15) \
-	_BINPROTO_FUNCTION_PARSE(name16) \
-	_BINPROTO_FUNCTION_PARSE(name17) \
-	_BINPROTO_FUNCTION_PARSE(name18) \
-	_BINPROTO_FUNCTION_PARSE(name19) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
+	_BINPROTO_FUNCTION_PARSE(12,name12) \
+	_BINPROTO_FUNCTION_PARSE(13,name13) \
+	_BINPROTO_FUNCTION_PARSE(14,name14) \
+	_BINPROTO_FUNCTION_PARSE(15,name15) \
+	_BINPROTO_FUNCTION_PARSE(16,name16) \
+	_BINPROTO_FUNCTION_PARSE(17,name17) \
+	_BINPROTO_FUNCTION_PARSE(18,name18) \
+	_BINPROTO_FUNCTION_PARSE(19,name19) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,12,name12) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,13,name13) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,14,name14) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,15,name15) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,16,name16) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,17,name17) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,18,name18) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,19,name19) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME(12,name12) \
+	_BINPROTO_FUNCTION_PARSE_SOME(13,name13) \
+	_BINPROTO_FUNCTION_PARSE_SOME(14,name14) \
+	_BINPROTO_FUNCTION_PARSE_SOME(15,name15) \
+	_BINPROTO_FUNCTION_PARSE_SOME(16,name16) \
+	_BINPROTO_FUNCTION_PARSE_SOME(17,name17) \
+	_BINPROTO_FUNCTION_PARSE_SOME(18,name18) \
+	_BINPROTO_FUNCTION_PARSE_SOME(19,name19) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
-	_BINPROTO_FUNCTION_SERIALIZE(name12) \
-	_BINPROTO_FUNCTION_SERIALIZE(name13) \
-	_BINPROTO_FUNCTION_SERIALIZE(name14) \
-	_BINPROTO_FUNCTION_SERIALIZE(name15) \
-	_BINPROTO_FUNCTION_SERIALIZE(name16) \
-	_BINPROTO_FUNCTION_SERIALIZE(name17) \
-	_BINPROTO_FUNCTION_SERIALIZE(name18) \
-	_BINPROTO_FUNCTION_SERIALIZE(name19) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(12,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE(13,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE(14,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE(15,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE(16,name16) \
+	_BINPROTO_FUNCTION_SERIALIZE(17,name17) \
+	_BINPROTO_FUNCTION_SERIALIZE(18,name18) \
+	_BINPROTO_FUNCTION_SERIALIZE(19,name19) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK(12,name12) \
+	_BINPROTO_FUNCTION_SINK(13,name13) \
+	_BINPROTO_FUNCTION_SINK(14,name14) \
+	_BINPROTO_FUNCTION_SINK(15,name15) \
+	_BINPROTO_FUNCTION_SINK(16,name16) \
+	_BINPROTO_FUNCTION_SINK(17,name17) \
+	_BINPROTO_FUNCTION_SINK(18,name18) \
+	_BINPROTO_FUNCTION_SINK(19,name19) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
-	_BINPROTO_FUNCTION_GETLEN(name12) \
-	_BINPROTO_FUNCTION_GETLEN(name13) \
-	_BINPROTO_FUNCTION_GETLEN(name14) \
-	_BINPROTO_FUNCTION_GETLEN(name15) \
-	_BINPROTO_FUNCTION_GETLEN(name16) \
-	_BINPROTO_FUNCTION_GETLEN(name17) \
-	_BINPROTO_FUNCTION_GETLEN(name18) \
-	_BINPROTO_FUNCTION_GETLEN(name19) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
+	_BINPROTO_FUNCTION_GETLEN(12,name12) \
+	_BINPROTO_FUNCTION_GETLEN(13,name13) \
+	_BINPROTO_FUNCTION_GETLEN(14,name14) \
+	_BINPROTO_FUNCTION_GETLEN(15,name15) \
+	_BINPROTO_FUNCTION_GETLEN(16,name16) \
+	_BINPROTO_FUNCTION_GETLEN(17,name17) \
+	_BINPROTO_FUNCTION_GETLEN(18,name18) \
+	_BINPROTO_FUNCTION_GETLEN(19,name19) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_FUNCTION_SKIP(12,11) \
+	_BINPROTO_FUNCTION_SKIP(13,12) \
+	_BINPROTO_FUNCTION_SKIP(14,13) \
+	_BINPROTO_FUNCTION_SKIP(15,14) \
+	_BINPROTO_FUNCTION_SKIP(16,15) \
+	_BINPROTO_FUNCTION_SKIP(17,16) \
+	_BINPROTO_FUNCTION_SKIP(18,17) \
+	_BINPROTO_FUNCTION_SKIP(19,18) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE(12,11) \
+	_BINPROTO_FUNCTION_VALIDATE(13,12) \
+	_BINPROTO_FUNCTION_VALIDATE(14,13) \
+	_BINPROTO_FUNCTION_VALIDATE(15,14) \
+	_BINPROTO_FUNCTION_VALIDATE(16,15) \
+	_BINPROTO_FUNCTION_VALIDATE(17,16) \
+	_BINPROTO_FUNCTION_VALIDATE(18,17) \
+	_BINPROTO_FUNCTION_VALIDATE(19,18) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_FIELD(classname,12,11,name12) \
+	_BINPROTO_VIEW_FIELD(classname,13,12,name13) \
+	_BINPROTO_VIEW_FIELD(classname,14,13,name14) \
+	_BINPROTO_VIEW_FIELD(classname,15,14,name15) \
+	_BINPROTO_VIEW_FIELD(classname,16,15,name16) \
+	_BINPROTO_VIEW_FIELD(classname,17,16,name17) \
+	_BINPROTO_VIEW_FIELD(classname,18,17,name18) \
+	_BINPROTO_VIEW_FIELD(classname,19,18,name19) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET(12) \
+	_BINPROTO_VIEW_RESET(13) \
+	_BINPROTO_VIEW_RESET(14) \
+	_BINPROTO_VIEW_RESET(15) \
+	_BINPROTO_VIEW_RESET(16) \
+	_BINPROTO_VIEW_RESET(17) \
+	_BINPROTO_VIEW_RESET(18) \
+	_BINPROTO_VIEW_RESET(19) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,19) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMN(12,name12) \
+	_BINPROTO_COLUMN(13,name13) \
+	_BINPROTO_COLUMN(14,name14) \
+	_BINPROTO_COLUMN(15,name15) \
+	_BINPROTO_COLUMN(16,name16) \
+	_BINPROTO_COLUMN(17,name17) \
+	_BINPROTO_COLUMN(18,name18) \
+	_BINPROTO_COLUMN(19,name19) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMN_CLEAR(name12) \
+	_BINPROTO_COLUMN_CLEAR(name13) \
+	_BINPROTO_COLUMN_CLEAR(name14) \
+	_BINPROTO_COLUMN_CLEAR(name15) \
+	_BINPROTO_COLUMN_CLEAR(name16) \
+	_BINPROTO_COLUMN_CLEAR(name17) \
+	_BINPROTO_COLUMN_CLEAR(name18) \
+	_BINPROTO_COLUMN_CLEAR(name19) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMN_RESERVE(name12) \
+	_BINPROTO_COLUMN_RESERVE(name13) \
+	_BINPROTO_COLUMN_RESERVE(name14) \
+	_BINPROTO_COLUMN_RESERVE(name15) \
+	_BINPROTO_COLUMN_RESERVE(name16) \
+	_BINPROTO_COLUMN_RESERVE(name17) \
+	_BINPROTO_COLUMN_RESERVE(name18) \
+	_BINPROTO_COLUMN_RESERVE(name19) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMN_PUSH(name12) \
+	_BINPROTO_COLUMN_PUSH(name13) \
+	_BINPROTO_COLUMN_PUSH(name14) \
+	_BINPROTO_COLUMN_PUSH(name15) \
+	_BINPROTO_COLUMN_PUSH(name16) \
+	_BINPROTO_COLUMN_PUSH(name17) \
+	_BINPROTO_COLUMN_PUSH(name18) \
+	_BINPROTO_COLUMN_PUSH(name19) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMN_GET(name12) \
+	_BINPROTO_COLUMN_GET(name13) \
+	_BINPROTO_COLUMN_GET(name14) \
+	_BINPROTO_COLUMN_GET(name15) \
+	_BINPROTO_COLUMN_GET(name16) \
+	_BINPROTO_COLUMN_GET(name17) \
+	_BINPROTO_COLUMN_GET(name18) \
+	_BINPROTO_COLUMN_GET(name19) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMN_PARSE(12,11,name12) \
+	_BINPROTO_COLUMN_PARSE(13,12,name13) \
+	_BINPROTO_COLUMN_PARSE(14,13,name14) \
+	_BINPROTO_COLUMN_PARSE(15,14,name15) \
+	_BINPROTO_COLUMN_PARSE(16,15,name16) \
+	_BINPROTO_COLUMN_PARSE(17,16,name17) \
+	_BINPROTO_COLUMN_PARSE(18,17,name18) \
+	_BINPROTO_COLUMN_PARSE(19,18,name19) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMN_SERIALIZE(12,11,name12) \
+	_BINPROTO_COLUMN_SERIALIZE(13,12,name13) \
+	_BINPROTO_COLUMN_SERIALIZE(14,13,name14) \
+	_BINPROTO_COLUMN_SERIALIZE(15,14,name15) \
+	_BINPROTO_COLUMN_SERIALIZE(16,15,name16) \
+	_BINPROTO_COLUMN_SERIALIZE(17,16,name17) \
+	_BINPROTO_COLUMN_SERIALIZE(18,17,name18) \
+	_BINPROTO_COLUMN_SERIALIZE(19,18,name19) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMN_GETLEN(name12) \
+	_BINPROTO_COLUMN_GETLEN(name13) \
+	_BINPROTO_COLUMN_GETLEN(name14) \
+	_BINPROTO_COLUMN_GETLEN(name15) \
+	_BINPROTO_COLUMN_GETLEN(name16) \
+	_BINPROTO_COLUMN_GETLEN(name17) \
+	_BINPROTO_COLUMN_GETLEN(name18) \
+	_BINPROTO_COLUMN_GETLEN(name19) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
@@ -2308,6 +12041,69 @@ namespace binproto
 	+(type19::STATIC_BINARY_LENGTH) \
 	+(type20::STATIC_BINARY_LENGTH) \
 	_BINPROTO_DEFINE_STATIC_BINARY_LENGTH_END \
+	typedef type01 _binproto_field_type01; \
+	typedef type02 _binproto_field_type02; \
+	typedef type03 _binproto_field_type03; \
+	typedef type04 _binproto_field_type04; \
+	typedef type05 _binproto_field_type05; \
+	typedef type06 _binproto_field_type06; \
+	typedef type07 _binproto_field_type07; \
+	typedef type08 _binproto_field_type08; \
+	typedef type09 _binproto_field_type09; \
+	typedef type10 _binproto_field_type10; \
+	typedef type11 _binproto_field_type11; \
+	typedef type12 _binproto_field_type12; \
+	typedef type13 _binproto_field_type13; \
+	typedef type14 _binproto_field_type14; \
+	typedef type15 _binproto_field_type15; \
+	typedef type16 _binproto_field_type16; \
+	typedef type17 _binproto_field_type17; \
+	typedef type18 _binproto_field_type18; \
+	typedef type19 _binproto_field_type19; \
+	typedef type20 _binproto_field_type20; \
+	_BINPROTO_DEFINE_FIELD_OFFSET_START \
+	_BINPROTO_DEFINE_FIELD_OFFSET(01,00) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(02,01) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(03,02) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(04,03) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(05,04) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(06,05) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(07,06) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(08,07) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(09,08) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(10,09) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(11,10) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(12,11) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(13,12) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(14,13) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(15,14) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(16,15) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(17,16) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(18,17) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(19,18) \
+	_BINPROTO_DEFINE_FIELD_OFFSET(20,19) \
+	_BINPROTO_DEFINE_PRESENCE_START \
+	_BINPROTO_DEFINE_PRESENCE(01,00) \
+	_BINPROTO_DEFINE_PRESENCE(02,01) \
+	_BINPROTO_DEFINE_PRESENCE(03,02) \
+	_BINPROTO_DEFINE_PRESENCE(04,03) \
+	_BINPROTO_DEFINE_PRESENCE(05,04) \
+	_BINPROTO_DEFINE_PRESENCE(06,05) \
+	_BINPROTO_DEFINE_PRESENCE(07,06) \
+	_BINPROTO_DEFINE_PRESENCE(08,07) \
+	_BINPROTO_DEFINE_PRESENCE(09,08) \
+	_BINPROTO_DEFINE_PRESENCE(10,09) \
+	_BINPROTO_DEFINE_PRESENCE(11,10) \
+	_BINPROTO_DEFINE_PRESENCE(12,11) \
+	_BINPROTO_DEFINE_PRESENCE(13,12) \
+	_BINPROTO_DEFINE_PRESENCE(14,13) \
+	_BINPROTO_DEFINE_PRESENCE(15,14) \
+	_BINPROTO_DEFINE_PRESENCE(16,15) \
+	_BINPROTO_DEFINE_PRESENCE(17,16) \
+	_BINPROTO_DEFINE_PRESENCE(18,17) \
+	_BINPROTO_DEFINE_PRESENCE(19,18) \
+	_BINPROTO_DEFINE_PRESENCE(20,19) \
+	_BINPROTO_DEFINE_PRESENCE_END(20) \
 	type01 name01; \
 	type02 name02; \
 	type03 name03; \
@@ -2328,74 +12124,487 @@ namespace binproto
 	type18 name18; \
 	type19 name19; \
 	type20 name20; \
+	_BINPROTO_FUNCTION_STATIC_START \
+	_BINPROTO_FUNCTION_PARSE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(17,16,name17) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(18,17,name18) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(19,18,name19) \
+	_BINPROTO_FUNCTION_PARSE_STATIC(20,19,name20) \
+	_BINPROTO_FUNCTION_STATIC_MIDDLE \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(01,00,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(02,01,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(03,02,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(04,03,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(05,04,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(06,05,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(07,06,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(08,07,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(09,08,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(10,09,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(11,10,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(12,11,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(13,12,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(14,13,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(15,14,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(16,15,name16) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(17,16,name17) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(18,17,name18) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(19,18,name19) \
+	_BINPROTO_FUNCTION_SERIALIZE_STATIC(20,19,name20) \
+	_BINPROTO_FUNCTION_STATIC_END \
+	_BINPROTO_FUNCTION_PRESENCE_START \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(17,16,name17) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(18,17,name18) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(19,18,name19) \
+	_BINPROTO_FUNCTION_APPLY_PRESENCE(20,19,name20) \
+	_BINPROTO_FUNCTION_PRESENCE_MIDDLE \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(01,00,name01) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(02,01,name02) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(03,02,name03) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(04,03,name04) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(05,04,name05) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(06,05,name06) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(07,06,name07) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(08,07,name08) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(09,08,name09) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(10,09,name10) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(11,10,name11) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(12,11,name12) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(13,12,name13) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(14,13,name14) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(15,14,name15) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(16,15,name16) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(17,16,name17) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(18,17,name18) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(19,18,name19) \
+	_BINPROTO_FUNCTION_WRITE_PRESENCE(20,19,name20) \
+	_BINPROTO_FUNCTION_PRESENCE_END \
 	_BINPROTO_FUNCTION_PARSE_START \
 	_BINPROTO_PARSE_TRY \
-	_BINPROTO_FUNCTION_PARSE(name01) \
-	_BINPROTO_FUNCTION_PARSE(name02) \
-	_BINPROTO_FUNCTION_PARSE(name03) \
-	_BINPROTO_FUNCTION_PARSE(name04) \
-	_BINPROTO_FUNCTION_PARSE(name05) \
-	_BINPROTO_FUNCTION_PARSE(name06) \
-	_BINPROTO_FUNCTION_PARSE(name07) \
-	_BINPROTO_FUNCTION_PARSE(name08) \
-	_BINPROTO_FUNCTION_PARSE(name09) \
-	_BINPROTO_FUNCTION_PARSE(name10) \
-	_BINPROTO_FUNCTION_PARSE(name11) \
-	_BINPROTO_FUNCTION_PARSE(name12) \
-	_BINPROTO_FUNCTION_PARSE(name13) \
-	_BINPROTO_FUNCTION_PARSE(name14) \
-	_BINPROTO_FUNCTION_PARSE(name15) \
-	_BINPROTO_FUNCTION_PARSE(name16) \
-	_BINPROTO_FUNCTION_PARSE(name17) \
-	_BINPROTO_FUNCTION_PARSE(name18) \
-	_BINPROTO_FUNCTION_PARSE(name19) \
-	_BINPROTO_FUNCTION_PARSE(name20) \
+	_BINPROTO_FUNCTION_PARSE_PRESENCE \
+	_BINPROTO_FUNCTION_PARSE(01,name01) \
+	_BINPROTO_FUNCTION_PARSE(02,name02) \
+	_BINPROTO_FUNCTION_PARSE(03,name03) \
+	_BINPROTO_FUNCTION_PARSE(04,name04) \
+	_BINPROTO_FUNCTION_PARSE(05,name05) \
+	_BINPROTO_FUNCTION_PARSE(06,name06) \
+	_BINPROTO_FUNCTION_PARSE(07,name07) \
+	_BINPROTO_FUNCTION_PARSE(08,name08) \
+	_BINPROTO_FUNCTION_PARSE(09,name09) \
+	_BINPROTO_FUNCTION_PARSE(10,name10) \
+	_BINPROTO_FUNCTION_PARSE(11,name11) \
+	_BINPROTO_FUNCTION_PARSE(12,name12) \
+	_BINPROTO_FUNCTION_PARSE(13,name13) \
+	_BINPROTO_FUNCTION_PARSE(14,name14) \
+	_BINPROTO_FUNCTION_PARSE(15,name15) \
+	_BINPROTO_FUNCTION_PARSE(16,name16) \
+	_BINPROTO_FUNCTION_PARSE(17,name17) \
+	_BINPROTO_FUNCTION_PARSE(18,name18) \
+	_BINPROTO_FUNCTION_PARSE(19,name19) \
+	_BINPROTO_FUNCTION_PARSE(20,name20) \
 	_BINPROTO_PARSE_CATCH(#classname) \
 	_BINPROTO_FUNCTION_PARSE_END \
+	_BINPROTO_FUNCTION_STATUS_PARSE_START \
+	_BINPROTO_FUNCTION_STATUS_PARSE_PRESENCE(classname) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,01,name01) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,02,name02) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,03,name03) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,04,name04) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,05,name05) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,06,name06) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,07,name07) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,08,name08) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,09,name09) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,10,name10) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,11,name11) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,12,name12) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,13,name13) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,14,name14) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,15,name15) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,16,name16) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,17,name17) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,18,name18) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,19,name19) \
+	_BINPROTO_FUNCTION_STATUS_PARSE(classname,20,name20) \
+	_BINPROTO_FUNCTION_STATUS_PARSE_END \
+	_BINPROTO_FUNCTION_PARSE_SOME_START \
+	_BINPROTO_FUNCTION_PARSE_SOME(01,name01) \
+	_BINPROTO_FUNCTION_PARSE_SOME(02,name02) \
+	_BINPROTO_FUNCTION_PARSE_SOME(03,name03) \
+	_BINPROTO_FUNCTION_PARSE_SOME(04,name04) \
+	_BINPROTO_FUNCTION_PARSE_SOME(05,name05) \
+	_BINPROTO_FUNCTION_PARSE_SOME(06,name06) \
+	_BINPROTO_FUNCTION_PARSE_SOME(07,name07) \
+	_BINPROTO_FUNCTION_PARSE_SOME(08,name08) \
+	_BINPROTO_FUNCTION_PARSE_SOME(09,name09) \
+	_BINPROTO_FUNCTION_PARSE_SOME(10,name10) \
+	_BINPROTO_FUNCTION_PARSE_SOME(11,name11) \
+	_BINPROTO_FUNCTION_PARSE_SOME(12,name12) \
+	_BINPROTO_FUNCTION_PARSE_SOME(13,name13) \
+	_BINPROTO_FUNCTION_PARSE_SOME(14,name14) \
+	_BINPROTO_FUNCTION_PARSE_SOME(15,name15) \
+	_BINPROTO_FUNCTION_PARSE_SOME(16,name16) \
+	_BINPROTO_FUNCTION_PARSE_SOME(17,name17) \
+	_BINPROTO_FUNCTION_PARSE_SOME(18,name18) \
+	_BINPROTO_FUNCTION_PARSE_SOME(19,name19) \
+	_BINPROTO_FUNCTION_PARSE_SOME(20,name20) \
+	_BINPROTO_FUNCTION_PARSE_SOME_END \
 	_BINPROTO_FUNCTION_SERIALIZE_START \
-	_BINPROTO_FUNCTION_SERIALIZE(name01) \
-	_BINPROTO_FUNCTION_SERIALIZE(name02) \
-	_BINPROTO_FUNCTION_SERIALIZE(name03) \
-	_BINPROTO_FUNCTION_SERIALIZE(name04) \
-	_BINPROTO_FUNCTION_SERIALIZE(name05) \
-	_BINPROTO_FUNCTION_SERIALIZE(name06) \
-	_BINPROTO_FUNCTION_SERIALIZE(name07) \
-	_BINPROTO_FUNCTION_SERIALIZE(name08) \
-	_BINPROTO_FUNCTION_SERIALIZE(name09) \
-	_BINPROTO_FUNCTION_SERIALIZE(name10) \
-	_BINPROTO_FUNCTION_SERIALIZE(name11) \
-	_BINPROTO_FUNCTION_SERIALIZE(name12) \
-	_BINPROTO_FUNCTION_SERIALIZE(name13) \
-	_BINPROTO_FUNCTION_SERIALIZE(name14) \
-	_BINPROTO_FUNCTION_SERIALIZE(name15) \
-	_BINPROTO_FUNCTION_SERIALIZE(name16) \
-	_BINPROTO_FUNCTION_SERIALIZE(name17) \
-	_BINPROTO_FUNCTION_SERIALIZE(name18) \
-	_BINPROTO_FUNCTION_SERIALIZE(name19) \
-	_BINPROTO_FUNCTION_SERIALIZE(name20) \
+	_BINPROTO_FUNCTION_SERIALIZE(01,name01) \
+	_BINPROTO_FUNCTION_SERIALIZE(02,name02) \
+	_BINPROTO_FUNCTION_SERIALIZE(03,name03) \
+	_BINPROTO_FUNCTION_SERIALIZE(04,name04) \
+	_BINPROTO_FUNCTION_SERIALIZE(05,name05) \
+	_BINPROTO_FUNCTION_SERIALIZE(06,name06) \
+	_BINPROTO_FUNCTION_SERIALIZE(07,name07) \
+	_BINPROTO_FUNCTION_SERIALIZE(08,name08) \
+	_BINPROTO_FUNCTION_SERIALIZE(09,name09) \
+	_BINPROTO_FUNCTION_SERIALIZE(10,name10) \
+	_BINPROTO_FUNCTION_SERIALIZE(11,name11) \
+	_BINPROTO_FUNCTION_SERIALIZE(12,name12) \
+	_BINPROTO_FUNCTION_SERIALIZE(13,name13) \
+	_BINPROTO_FUNCTION_SERIALIZE(14,name14) \
+	_BINPROTO_FUNCTION_SERIALIZE(15,name15) \
+	_BINPROTO_FUNCTION_SERIALIZE(16,name16) \
+	_BINPROTO_FUNCTION_SERIALIZE(17,name17) \
+	_BINPROTO_FUNCTION_SERIALIZE(18,name18) \
+	_BINPROTO_FUNCTION_SERIALIZE(19,name19) \
+	_BINPROTO_FUNCTION_SERIALIZE(20,name20) \
 	_BINPROTO_FUNCTION_SERIALIZE_END \
+	_BINPROTO_FUNCTION_SINK_START \
+	_BINPROTO_FUNCTION_SINK(01,name01) \
+	_BINPROTO_FUNCTION_SINK(02,name02) \
+	_BINPROTO_FUNCTION_SINK(03,name03) \
+	_BINPROTO_FUNCTION_SINK(04,name04) \
+	_BINPROTO_FUNCTION_SINK(05,name05) \
+	_BINPROTO_FUNCTION_SINK(06,name06) \
+	_BINPROTO_FUNCTION_SINK(07,name07) \
+	_BINPROTO_FUNCTION_SINK(08,name08) \
+	_BINPROTO_FUNCTION_SINK(09,name09) \
+	_BINPROTO_FUNCTION_SINK(10,name10) \
+	_BINPROTO_FUNCTION_SINK(11,name11) \
+	_BINPROTO_FUNCTION_SINK(12,name12) \
+	_BINPROTO_FUNCTION_SINK(13,name13) \
+	_BINPROTO_FUNCTION_SINK(14,name14) \
+	_BINPROTO_FUNCTION_SINK(15,name15) \
+	_BINPROTO_FUNCTION_SINK(16,name16) \
+	_BINPROTO_FUNCTION_SINK(17,name17) \
+	_BINPROTO_FUNCTION_SINK(18,name18) \
+	_BINPROTO_FUNCTION_SINK(19,name19) \
+	_BINPROTO_FUNCTION_SINK(20,name20) \
+	_BINPROTO_FUNCTION_SINK_END \
 	_BINPROTO_FUNCTION_GETLEN_START \
-	_BINPROTO_FUNCTION_GETLEN(name01) \
-	_BINPROTO_FUNCTION_GETLEN(name02) \
-	_BINPROTO_FUNCTION_GETLEN(name03) \
-	_BINPROTO_FUNCTION_GETLEN(name04) \
-	_BINPROTO_FUNCTION_GETLEN(name05) \
-	_BINPROTO_FUNCTION_GETLEN(name06) \
-	_BINPROTO_FUNCTION_GETLEN(name07) \
-	_BINPROTO_FUNCTION_GETLEN(name08) \
-	_BINPROTO_FUNCTION_GETLEN(name09) \
-	_BINPROTO_FUNCTION_GETLEN(name10) \
-	_BINPROTO_FUNCTION_GETLEN(name11) \
-	_BINPROTO_FUNCTION_GETLEN(name12) \
-	_BINPROTO_FUNCTION_GETLEN(name13) \
-	_BINPROTO_FUNCTION_GETLEN(name14) \
-	_BINPROTO_FUNCTION_GETLEN(name15) \
-	_BINPROTO_FUNCTION_GETLEN(name16) \
-	_BINPROTO_FUNCTION_GETLEN(name17) \
-	_BINPROTO_FUNCTION_GETLEN(name18) \
-	_BINPROTO_FUNCTION_GETLEN(name19) \
-	_BINPROTO_FUNCTION_GETLEN(name20) \
+	_BINPROTO_FUNCTION_GETLEN(01,name01) \
+	_BINPROTO_FUNCTION_GETLEN(02,name02) \
+	_BINPROTO_FUNCTION_GETLEN(03,name03) \
+	_BINPROTO_FUNCTION_GETLEN(04,name04) \
+	_BINPROTO_FUNCTION_GETLEN(05,name05) \
+	_BINPROTO_FUNCTION_GETLEN(06,name06) \
+	_BINPROTO_FUNCTION_GETLEN(07,name07) \
+	_BINPROTO_FUNCTION_GETLEN(08,name08) \
+	_BINPROTO_FUNCTION_GETLEN(09,name09) \
+	_BINPROTO_FUNCTION_GETLEN(10,name10) \
+	_BINPROTO_FUNCTION_GETLEN(11,name11) \
+	_BINPROTO_FUNCTION_GETLEN(12,name12) \
+	_BINPROTO_FUNCTION_GETLEN(13,name13) \
+	_BINPROTO_FUNCTION_GETLEN(14,name14) \
+	_BINPROTO_FUNCTION_GETLEN(15,name15) \
+	_BINPROTO_FUNCTION_GETLEN(16,name16) \
+	_BINPROTO_FUNCTION_GETLEN(17,name17) \
+	_BINPROTO_FUNCTION_GETLEN(18,name18) \
+	_BINPROTO_FUNCTION_GETLEN(19,name19) \
+	_BINPROTO_FUNCTION_GETLEN(20,name20) \
 	_BINPROTO_FUNCTION_GETLEN_END \
+	_BINPROTO_FUNCTION_SKIP_START(classname) \
+	_BINPROTO_PARSE_TRY \
+	_BINPROTO_FUNCTION_SKIP(01,00) \
+	_BINPROTO_FUNCTION_SKIP(02,01) \
+	_BINPROTO_FUNCTION_SKIP(03,02) \
+	_BINPROTO_FUNCTION_SKIP(04,03) \
+	_BINPROTO_FUNCTION_SKIP(05,04) \
+	_BINPROTO_FUNCTION_SKIP(06,05) \
+	_BINPROTO_FUNCTION_SKIP(07,06) \
+	_BINPROTO_FUNCTION_SKIP(08,07) \
+	_BINPROTO_FUNCTION_SKIP(09,08) \
+	_BINPROTO_FUNCTION_SKIP(10,09) \
+	_BINPROTO_FUNCTION_SKIP(11,10) \
+	_BINPROTO_FUNCTION_SKIP(12,11) \
+	_BINPROTO_FUNCTION_SKIP(13,12) \
+	_BINPROTO_FUNCTION_SKIP(14,13) \
+	_BINPROTO_FUNCTION_SKIP(15,14) \
+	_BINPROTO_FUNCTION_SKIP(16,15) \
+	_BINPROTO_FUNCTION_SKIP(17,16) \
+	_BINPROTO_FUNCTION_SKIP(18,17) \
+	_BINPROTO_FUNCTION_SKIP(19,18) \
+	_BINPROTO_FUNCTION_SKIP(20,19) \
+	_BINPROTO_PARSE_CATCH(#classname) \
+	_BINPROTO_FUNCTION_SKIP_END \
+	_BINPROTO_FUNCTION_VALIDATE_START \
+	_BINPROTO_FUNCTION_VALIDATE(01,00) \
+	_BINPROTO_FUNCTION_VALIDATE(02,01) \
+	_BINPROTO_FUNCTION_VALIDATE(03,02) \
+	_BINPROTO_FUNCTION_VALIDATE(04,03) \
+	_BINPROTO_FUNCTION_VALIDATE(05,04) \
+	_BINPROTO_FUNCTION_VALIDATE(06,05) \
+	_BINPROTO_FUNCTION_VALIDATE(07,06) \
+	_BINPROTO_FUNCTION_VALIDATE(08,07) \
+	_BINPROTO_FUNCTION_VALIDATE(09,08) \
+	_BINPROTO_FUNCTION_VALIDATE(10,09) \
+	_BINPROTO_FUNCTION_VALIDATE(11,10) \
+	_BINPROTO_FUNCTION_VALIDATE(12,11) \
+	_BINPROTO_FUNCTION_VALIDATE(13,12) \
+	_BINPROTO_FUNCTION_VALIDATE(14,13) \
+	_BINPROTO_FUNCTION_VALIDATE(15,14) \
+	_BINPROTO_FUNCTION_VALIDATE(16,15) \
+	_BINPROTO_FUNCTION_VALIDATE(17,16) \
+	_BINPROTO_FUNCTION_VALIDATE(18,17) \
+	_BINPROTO_FUNCTION_VALIDATE(19,18) \
+	_BINPROTO_FUNCTION_VALIDATE(20,19) \
+	_BINPROTO_FUNCTION_VALIDATE_END \
+	_BINPROTO_VIEW_DEFINE_START(classname) \
+	_BINPROTO_VIEW_FIELD(classname,01,00,name01) \
+	_BINPROTO_VIEW_FIELD(classname,02,01,name02) \
+	_BINPROTO_VIEW_FIELD(classname,03,02,name03) \
+	_BINPROTO_VIEW_FIELD(classname,04,03,name04) \
+	_BINPROTO_VIEW_FIELD(classname,05,04,name05) \
+	_BINPROTO_VIEW_FIELD(classname,06,05,name06) \
+	_BINPROTO_VIEW_FIELD(classname,07,06,name07) \
+	_BINPROTO_VIEW_FIELD(classname,08,07,name08) \
+	_BINPROTO_VIEW_FIELD(classname,09,08,name09) \
+	_BINPROTO_VIEW_FIELD(classname,10,09,name10) \
+	_BINPROTO_VIEW_FIELD(classname,11,10,name11) \
+	_BINPROTO_VIEW_FIELD(classname,12,11,name12) \
+	_BINPROTO_VIEW_FIELD(classname,13,12,name13) \
+	_BINPROTO_VIEW_FIELD(classname,14,13,name14) \
+	_BINPROTO_VIEW_FIELD(classname,15,14,name15) \
+	_BINPROTO_VIEW_FIELD(classname,16,15,name16) \
+	_BINPROTO_VIEW_FIELD(classname,17,16,name17) \
+	_BINPROTO_VIEW_FIELD(classname,18,17,name18) \
+	_BINPROTO_VIEW_FIELD(classname,19,18,name19) \
+	_BINPROTO_VIEW_FIELD(classname,20,19,name20) \
+	_BINPROTO_VIEW_RESET_START \
+	_BINPROTO_VIEW_RESET(01) \
+	_BINPROTO_VIEW_RESET(02) \
+	_BINPROTO_VIEW_RESET(03) \
+	_BINPROTO_VIEW_RESET(04) \
+	_BINPROTO_VIEW_RESET(05) \
+	_BINPROTO_VIEW_RESET(06) \
+	_BINPROTO_VIEW_RESET(07) \
+	_BINPROTO_VIEW_RESET(08) \
+	_BINPROTO_VIEW_RESET(09) \
+	_BINPROTO_VIEW_RESET(10) \
+	_BINPROTO_VIEW_RESET(11) \
+	_BINPROTO_VIEW_RESET(12) \
+	_BINPROTO_VIEW_RESET(13) \
+	_BINPROTO_VIEW_RESET(14) \
+	_BINPROTO_VIEW_RESET(15) \
+	_BINPROTO_VIEW_RESET(16) \
+	_BINPROTO_VIEW_RESET(17) \
+	_BINPROTO_VIEW_RESET(18) \
+	_BINPROTO_VIEW_RESET(19) \
+	_BINPROTO_VIEW_RESET(20) \
+	_BINPROTO_VIEW_RESET_END \
+	_BINPROTO_VIEW_DEFINE_END(classname,20) \
+	_BINPROTO_COLUMNS_DEFINE_START \
+	_BINPROTO_COLUMN(01,name01) \
+	_BINPROTO_COLUMN(02,name02) \
+	_BINPROTO_COLUMN(03,name03) \
+	_BINPROTO_COLUMN(04,name04) \
+	_BINPROTO_COLUMN(05,name05) \
+	_BINPROTO_COLUMN(06,name06) \
+	_BINPROTO_COLUMN(07,name07) \
+	_BINPROTO_COLUMN(08,name08) \
+	_BINPROTO_COLUMN(09,name09) \
+	_BINPROTO_COLUMN(10,name10) \
+	_BINPROTO_COLUMN(11,name11) \
+	_BINPROTO_COLUMN(12,name12) \
+	_BINPROTO_COLUMN(13,name13) \
+	_BINPROTO_COLUMN(14,name14) \
+	_BINPROTO_COLUMN(15,name15) \
+	_BINPROTO_COLUMN(16,name16) \
+	_BINPROTO_COLUMN(17,name17) \
+	_BINPROTO_COLUMN(18,name18) \
+	_BINPROTO_COLUMN(19,name19) \
+	_BINPROTO_COLUMN(20,name20) \
+	_BINPROTO_COLUMNS_CLEAR_START \
+	_BINPROTO_COLUMN_CLEAR(name01) \
+	_BINPROTO_COLUMN_CLEAR(name02) \
+	_BINPROTO_COLUMN_CLEAR(name03) \
+	_BINPROTO_COLUMN_CLEAR(name04) \
+	_BINPROTO_COLUMN_CLEAR(name05) \
+	_BINPROTO_COLUMN_CLEAR(name06) \
+	_BINPROTO_COLUMN_CLEAR(name07) \
+	_BINPROTO_COLUMN_CLEAR(name08) \
+	_BINPROTO_COLUMN_CLEAR(name09) \
+	_BINPROTO_COLUMN_CLEAR(name10) \
+	_BINPROTO_COLUMN_CLEAR(name11) \
+	_BINPROTO_COLUMN_CLEAR(name12) \
+	_BINPROTO_COLUMN_CLEAR(name13) \
+	_BINPROTO_COLUMN_CLEAR(name14) \
+	_BINPROTO_COLUMN_CLEAR(name15) \
+	_BINPROTO_COLUMN_CLEAR(name16) \
+	_BINPROTO_COLUMN_CLEAR(name17) \
+	_BINPROTO_COLUMN_CLEAR(name18) \
+	_BINPROTO_COLUMN_CLEAR(name19) \
+	_BINPROTO_COLUMN_CLEAR(name20) \
+	_BINPROTO_COLUMNS_RESERVE_START \
+	_BINPROTO_COLUMN_RESERVE(name01) \
+	_BINPROTO_COLUMN_RESERVE(name02) \
+	_BINPROTO_COLUMN_RESERVE(name03) \
+	_BINPROTO_COLUMN_RESERVE(name04) \
+	_BINPROTO_COLUMN_RESERVE(name05) \
+	_BINPROTO_COLUMN_RESERVE(name06) \
+	_BINPROTO_COLUMN_RESERVE(name07) \
+	_BINPROTO_COLUMN_RESERVE(name08) \
+	_BINPROTO_COLUMN_RESERVE(name09) \
+	_BINPROTO_COLUMN_RESERVE(name10) \
+	_BINPROTO_COLUMN_RESERVE(name11) \
+	_BINPROTO_COLUMN_RESERVE(name12) \
+	_BINPROTO_COLUMN_RESERVE(name13) \
+	_BINPROTO_COLUMN_RESERVE(name14) \
+	_BINPROTO_COLUMN_RESERVE(name15) \
+	_BINPROTO_COLUMN_RESERVE(name16) \
+	_BINPROTO_COLUMN_RESERVE(name17) \
+	_BINPROTO_COLUMN_RESERVE(name18) \
+	_BINPROTO_COLUMN_RESERVE(name19) \
+	_BINPROTO_COLUMN_RESERVE(name20) \
+	_BINPROTO_COLUMNS_PUSH_START(classname) \
+	_BINPROTO_COLUMN_PUSH(name01) \
+	_BINPROTO_COLUMN_PUSH(name02) \
+	_BINPROTO_COLUMN_PUSH(name03) \
+	_BINPROTO_COLUMN_PUSH(name04) \
+	_BINPROTO_COLUMN_PUSH(name05) \
+	_BINPROTO_COLUMN_PUSH(name06) \
+	_BINPROTO_COLUMN_PUSH(name07) \
+	_BINPROTO_COLUMN_PUSH(name08) \
+	_BINPROTO_COLUMN_PUSH(name09) \
+	_BINPROTO_COLUMN_PUSH(name10) \
+	_BINPROTO_COLUMN_PUSH(name11) \
+	_BINPROTO_COLUMN_PUSH(name12) \
+	_BINPROTO_COLUMN_PUSH(name13) \
+	_BINPROTO_COLUMN_PUSH(name14) \
+	_BINPROTO_COLUMN_PUSH(name15) \
+	_BINPROTO_COLUMN_PUSH(name16) \
+	_BINPROTO_COLUMN_PUSH(name17) \
+	_BINPROTO_COLUMN_PUSH(name18) \
+	_BINPROTO_COLUMN_PUSH(name19) \
+	_BINPROTO_COLUMN_PUSH(name20) \
+	_BINPROTO_COLUMNS_GET_START(classname) \
+	_BINPROTO_COLUMN_GET(name01) \
+	_BINPROTO_COLUMN_GET(name02) \
+	_BINPROTO_COLUMN_GET(name03) \
+	_BINPROTO_COLUMN_GET(name04) \
+	_BINPROTO_COLUMN_GET(name05) \
+	_BINPROTO_COLUMN_GET(name06) \
+	_BINPROTO_COLUMN_GET(name07) \
+	_BINPROTO_COLUMN_GET(name08) \
+	_BINPROTO_COLUMN_GET(name09) \
+	_BINPROTO_COLUMN_GET(name10) \
+	_BINPROTO_COLUMN_GET(name11) \
+	_BINPROTO_COLUMN_GET(name12) \
+	_BINPROTO_COLUMN_GET(name13) \
+	_BINPROTO_COLUMN_GET(name14) \
+	_BINPROTO_COLUMN_GET(name15) \
+	_BINPROTO_COLUMN_GET(name16) \
+	_BINPROTO_COLUMN_GET(name17) \
+	_BINPROTO_COLUMN_GET(name18) \
+	_BINPROTO_COLUMN_GET(name19) \
+	_BINPROTO_COLUMN_GET(name20) \
+	_BINPROTO_COLUMNS_PARSE_START \
+	_BINPROTO_COLUMN_PARSE(01,00,name01) \
+	_BINPROTO_COLUMN_PARSE(02,01,name02) \
+	_BINPROTO_COLUMN_PARSE(03,02,name03) \
+	_BINPROTO_COLUMN_PARSE(04,03,name04) \
+	_BINPROTO_COLUMN_PARSE(05,04,name05) \
+	_BINPROTO_COLUMN_PARSE(06,05,name06) \
+	_BINPROTO_COLUMN_PARSE(07,06,name07) \
+	_BINPROTO_COLUMN_PARSE(08,07,name08) \
+	_BINPROTO_COLUMN_PARSE(09,08,name09) \
+	_BINPROTO_COLUMN_PARSE(10,09,name10) \
+	_BINPROTO_COLUMN_PARSE(11,10,name11) \
+	_BINPROTO_COLUMN_PARSE(12,11,name12) \
+	_BINPROTO_COLUMN_PARSE(13,12,name13) \
+	_BINPROTO_COLUMN_PARSE(14,13,name14) \
+	_BINPROTO_COLUMN_PARSE(15,14,name15) \
+	_BINPROTO_COLUMN_PARSE(16,15,name16) \
+	_BINPROTO_COLUMN_PARSE(17,16,name17) \
+	_BINPROTO_COLUMN_PARSE(18,17,name18) \
+	_BINPROTO_COLUMN_PARSE(19,18,name19) \
+	_BINPROTO_COLUMN_PARSE(20,19,name20) \
+	_BINPROTO_COLUMNS_SERIALIZE_START \
+	_BINPROTO_COLUMN_SERIALIZE(01,00,name01) \
+	_BINPROTO_COLUMN_SERIALIZE(02,01,name02) \
+	_BINPROTO_COLUMN_SERIALIZE(03,02,name03) \
+	_BINPROTO_COLUMN_SERIALIZE(04,03,name04) \
+	_BINPROTO_COLUMN_SERIALIZE(05,04,name05) \
+	_BINPROTO_COLUMN_SERIALIZE(06,05,name06) \
+	_BINPROTO_COLUMN_SERIALIZE(07,06,name07) \
+	_BINPROTO_COLUMN_SERIALIZE(08,07,name08) \
+	_BINPROTO_COLUMN_SERIALIZE(09,08,name09) \
+	_BINPROTO_COLUMN_SERIALIZE(10,09,name10) \
+	_BINPROTO_COLUMN_SERIALIZE(11,10,name11) \
+	_BINPROTO_COLUMN_SERIALIZE(12,11,name12) \
+	_BINPROTO_COLUMN_SERIALIZE(13,12,name13) \
+	_BINPROTO_COLUMN_SERIALIZE(14,13,name14) \
+	_BINPROTO_COLUMN_SERIALIZE(15,14,name15) \
+	_BINPROTO_COLUMN_SERIALIZE(16,15,name16) \
+	_BINPROTO_COLUMN_SERIALIZE(17,16,name17) \
+	_BINPROTO_COLUMN_SERIALIZE(18,17,name18) \
+	_BINPROTO_COLUMN_SERIALIZE(19,18,name19) \
+	_BINPROTO_COLUMN_SERIALIZE(20,19,name20) \
+	_BINPROTO_COLUMNS_GETLEN_START \
+	_BINPROTO_COLUMN_GETLEN(name01) \
+	_BINPROTO_COLUMN_GETLEN(name02) \
+	_BINPROTO_COLUMN_GETLEN(name03) \
+	_BINPROTO_COLUMN_GETLEN(name04) \
+	_BINPROTO_COLUMN_GETLEN(name05) \
+	_BINPROTO_COLUMN_GETLEN(name06) \
+	_BINPROTO_COLUMN_GETLEN(name07) \
+	_BINPROTO_COLUMN_GETLEN(name08) \
+	_BINPROTO_COLUMN_GETLEN(name09) \
+	_BINPROTO_COLUMN_GETLEN(name10) \
+	_BINPROTO_COLUMN_GETLEN(name11) \
+	_BINPROTO_COLUMN_GETLEN(name12) \
+	_BINPROTO_COLUMN_GETLEN(name13) \
+	_BINPROTO_COLUMN_GETLEN(name14) \
+	_BINPROTO_COLUMN_GETLEN(name15) \
+	_BINPROTO_COLUMN_GETLEN(name16) \
+	_BINPROTO_COLUMN_GETLEN(name17) \
+	_BINPROTO_COLUMN_GETLEN(name18) \
+	_BINPROTO_COLUMN_GETLEN(name19) \
+	_BINPROTO_COLUMN_GETLEN(name20) \
+	_BINPROTO_COLUMNS_DEFINE_END \
 	BINPROTO_PARSE_AND_SERIALIZE_ON_STD_CONTAINER \
 	_BINPROTO_PACKET_DEFINE_END
 
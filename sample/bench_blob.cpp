@@ -0,0 +1,77 @@
+//compressed_blob ratio and throughput against raw variable_len_string on log-like text
+//build: g++ -O2 -I.. bench_blob.cpp -o bench_blob
+
+#define __STDC_LIMIT_MACROS
+#define BINPROTO_DISABLE_ASSERT
+#include "binproto.hpp"
+#include <stdio.h>
+#include <time.h>
+
+static std::string log_text(uint32_t lines)
+{
+	static const char* const paths[] = {"/api/v1/items","/api/v1/users","/health","/api/v2/orders/search"};
+	std::string text;
+	char line[256];
+	uint32_t seed = 12345;
+	for(uint32_t i = 0; i < lines; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		sprintf(line,"{\"ts\":\"2024-05-01T12:%02u:%02u.%03uZ\",\"level\":\"%s\",\"path\":\"%s\",\"status\":%u,\"latency_us\":%u,\"request_id\":\"%08x\"}\n"
+			,(i / 60) % 60,i % 60,seed % 1000,(seed >> 8) % 10 == 0 ? "WARN" : "INFO"
+			,paths[(seed >> 12) % 4],(seed >> 16) % 20 == 0 ? 500 : 200,(seed >> 4) % 50000,seed);
+		text += line;
+	}
+	return text;
+}
+
+static double seconds_since(clock_t begin)
+{
+	double seconds = (double)(clock() - begin) / CLOCKS_PER_SEC;
+	return seconds > 0 ? seconds : 1e-9;
+}
+
+template<typename obj_type>
+static void bench(const char* name,const std::string& text,int rounds)
+{
+	std::vector<char> wire;
+	obj_type obj(text);
+	//assign drops the cached encoding, so every round encodes again,
+	//the object is built once and the cost of assign alone is taken off the encode time
+	clock_t begin = clock();
+	for(int i = 0; i < rounds; i++)
+		obj.assign(text.data(),text.size());
+	double assign = seconds_since(begin);
+	begin = clock();
+	for(int i = 0; i < rounds; i++)
+	{
+		obj.assign(text.data(),text.size());
+		wire.clear();
+		obj.serialize_to_buffer(wire);
+	}
+	double encode = seconds_since(begin) - assign;
+	encode = encode > 0 ? encode : 1e-9;
+	obj_type parsed;
+	binproto::parse_status status;
+	begin = clock();
+	for(int i = 0; i < rounds; i++)
+		parsed.parse_from_buffer(&wire[0],wire.size(),status);
+	double decode = seconds_since(begin);
+	double mb = (double)text.size() * rounds / 1e6;
+	printf("%-24s %8u -> %8u bytes, ratio %5.2f, encode %7.1f MB/s, decode %7.1f MB/s%s\n"
+		,name,(uint32_t)text.size(),(uint32_t)wire.size(),(double)text.size() / wire.size()
+		,mb / encode,mb / decode,status.ok() && parsed.size() == text.size() ? "" : " (decode failed)");
+}
+
+int main()
+{
+	const uint32_t sizes[] = {1000,10000,100000};
+	for(size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+	{
+		std::string text = log_text(sizes[i] / 100);
+		int rounds = (int)(200000000 / text.size()) + 1;
+		printf("-- log text of %u lines\n",sizes[i] / 100);
+		bench<binproto::variable_len_string<4> >("variable_len_string<4>",text,rounds);
+		bench<binproto::compressed_blob<4> >("compressed_blob<4>",text,rounds);
+	}
+	return 0;
+}
@@ -0,0 +1,68 @@
+//ring_frame_decoder throughput on small frames
+//build: g++ -O2 -I.. bench_frame.cpp -o bench_frame
+
+#define __STDC_LIMIT_MACROS
+#define BINPROTO_DISABLE_ASSERT
+#include "binproto.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+BINPROTO_DEFINE_PACKET_P02(Tick
+	,binproto::uint32_obj,seq
+	,binproto::uint16_obj,price);
+
+typedef binproto::frame_format<2,1> format;
+
+int main()
+{
+	//one block of frames which does not divide the ring size, so frames keep wrapping
+	std::vector<char> block;
+	for(int i = 0; i < 1000; i++)
+	{
+		Tick tick;
+		tick.seq = i;
+		tick.price = i & 0xff;
+		char buffer[16];
+		uint32_t n = format::serialize_frame(tick,1,buffer,sizeof(buffer));
+		block.insert(block.end(),buffer,buffer + n);
+	}
+
+	const int rounds = 5000;
+	binproto::ring_frame_decoder<format> decoder(64 * 1024);
+	uint64_t frames = 0;
+	uint64_t checksum = 0;
+	clock_t begin = clock();
+	for(int round = 0; round < rounds; round++)
+	{
+		uint32_t pos = 0;
+		while(pos < block.size())
+		{
+			//socket reads of at most 1500 bytes
+			uint32_t space;
+			char* dst = decoder.write_space(space);
+			uint32_t n = block.size() - pos;
+			n = n < space ? n : space;
+			n = n < 1500 ? n : 1500;
+			memcpy(dst,&block[pos],n);
+			decoder.commit_write(n);
+			pos += n;
+			binproto::frame_view frame;
+			while(decoder.next_frame(frame))
+			{
+				Tick tick;
+				binproto::parse_status status;
+				tick.parse_from_buffer(frame.data,frame.size,status);
+				checksum += tick.seq.to_int() + tick.price.to_int();
+				++frames;
+			}
+		}
+	}
+	double seconds = (double)(clock() - begin) / CLOCKS_PER_SEC;
+	if(seconds <= 0)
+		seconds = 1e-9;
+	printf("%llu frames of %u bytes in %.3f s, %.2f M frames/s, %.1f MB/s (checksum %llu)\n"
+		,(unsigned long long)frames,(uint32_t)(block.size() / 1000),seconds
+		,frames / seconds / 1e6,(double)block.size() * rounds / seconds / 1e6,(unsigned long long)checksum);
+	return decoder.error() ? 1 : 0;
+}
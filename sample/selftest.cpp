@@ -0,0 +1,1287 @@
+//round trip and malformed input checks of the binproto types
+//build: g++ -I.. selftest.cpp -o selftest (add -std=c++11 -pthread for thread_pool), prints the failing checks and returns 1 on failure
+
+#define __STDC_LIMIT_MACROS
+#include "binproto.hpp"
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(expr) \
+	do{if(!(expr)){printf("%s:%d: check failed: %s\n",__FILE__,__LINE__,#expr);++failures;}}while(0)
+
+BINPROTO_DEFINE_PACKET_P03(Student
+	,binproto::variable_len_string<1>,name
+	,binproto::uint8_obj,age
+	,binproto::fixed_len_string<10>,sex);
+
+static std::vector<char> bytes_of(const char* str,uint32_t len)
+{
+	return std::vector<char>(str,str + len);
+}
+
+//serializes obj, then parses the bytes back through every parse api and serializes again,
+//all of them must give the same bytes.
+template<typename obj_type>
+static std::vector<char> check_roundtrip(const obj_type& obj)
+{
+	std::vector<char> wire;
+	obj.serialize_to_buffer(wire);
+	CHECK(wire.size() == obj.get_binary_len());
+	const char* buffer = wire.empty() ? NULL : &wire[0];
+	uint32_t bufflen = wire.size();
+	{
+		binproto::growable_buffer_sink sink;
+		CHECK(obj.serialize_to_sink(sink) == bufflen);
+		CHECK(sink.size() == bufflen && memcmp(sink.data(),buffer,bufflen) == 0);
+	}
+	CHECK(obj_type::validate_buffer(buffer,bufflen) == bufflen);
+	{
+		obj_type parsed;
+		binproto::parse_status status;
+		CHECK(parsed.parse_from_buffer(buffer,bufflen,status) == bufflen && status.ok());
+		std::vector<char> again;
+		parsed.serialize_to_buffer(again);
+		CHECK(again == wire);
+	}
+#ifndef BINPROTO_NO_EXCEPTIONS
+	try
+	{
+		obj_type parsed;
+		CHECK(parsed.parse_from_buffer(buffer,bufflen) == bufflen);
+		std::vector<char> again;
+		parsed.serialize_to_buffer(again);
+		CHECK(again == wire);
+		CHECK(obj_type::skip_from_buffer(buffer,bufflen) == bufflen);
+	}
+	catch(const binproto::exception& ex)
+	{
+		printf("unexpected exception %s\n",ex.what().c_str());
+		++failures;
+	}
+#endif
+	//bytes arriving one at a time
+	{
+		obj_type parsed;
+		binproto::parse_cursor cursor;
+		const char* cur = buffer;
+		uint32_t left = bufflen;
+		bool done = false;
+		while(!done)
+		{
+			uint32_t chunk = left < 1 ? left : 1;
+			uint32_t avail = chunk;
+			done = parsed.parse_some(cur,avail,cursor,0);
+			left -= chunk - avail;
+			if(!done && (chunk == 0 || avail != 0))
+				break;
+		}
+		CHECK(done && left == 0 && !cursor.failed());
+		std::vector<char> again;
+		parsed.serialize_to_buffer(again);
+		CHECK(again == wire);
+	}
+	return wire;
+}
+
+//bytes which every parse api of obj_type must reject
+template<typename obj_type>
+static void check_malformed(const std::vector<char>& wire)
+{
+	const char* buffer = wire.empty() ? NULL : &wire[0];
+	uint32_t bufflen = wire.size();
+	CHECK(obj_type::validate_buffer(buffer,bufflen) == 0);
+	{
+		obj_type parsed;
+		binproto::parse_status status;
+		CHECK(parsed.parse_from_buffer(buffer,bufflen,status) == 0 && !status.ok());
+	}
+#ifndef BINPROTO_NO_EXCEPTIONS
+	bool thrown = false;
+	try
+	{
+		obj_type parsed;
+		parsed.parse_from_buffer(buffer,bufflen);
+	}
+	catch(const binproto::exception&)
+	{
+		thrown = true;
+	}
+	CHECK(thrown);
+#endif
+}
+
+//bytes which parse_some must reject by failing the cursor, rather than wait for more
+template<typename obj_type>
+static void check_stream_malformed(const std::vector<char>& wire)
+{
+	obj_type parsed;
+	binproto::parse_cursor cursor;
+	const char* buffer = wire.empty() ? NULL : &wire[0];
+	uint32_t bufflen = wire.size();
+	CHECK(!parsed.parse_some(buffer,bufflen,cursor,0) && cursor.failed());
+}
+
+//every proper prefix of a serialized object is too short
+template<typename obj_type>
+static void check_truncated(const std::vector<char>& wire)
+{
+	for(size_t n = 0; n < wire.size(); n++)
+		check_malformed<obj_type>(std::vector<char>(wire.begin(),wire.begin() + n));
+}
+
+static void check_strings()
+{
+	binproto::variable_len_string<1> str("hello");
+	check_roundtrip(str);
+	check_roundtrip(binproto::variable_len_string<4>(""));
+	check_roundtrip(binproto::fixed_len_string<8>("abc"));
+
+	std::vector<char> wire = check_roundtrip(binproto::variable_len_string<2>("view me"));
+	binproto::variable_len_string_view<2> view;
+	CHECK(view.parse_from_buffer(&wire[0],wire.size()) == wire.size());
+	CHECK(view.size() == 7 && memcmp(view.data(),"view me",7) == 0);
+
+	//a length prefix past the end of the buffer, 0xfffffffe would wrap a temp_len + length check
+	const char huge[] = {(char)0xff,(char)0xff,(char)0xff,(char)0xfe,'a','b','c','d'};
+	check_malformed<binproto::variable_len_string<4> >(bytes_of(huge,sizeof(huge)));
+	check_malformed<binproto::variable_len_string_view<4> >(bytes_of(huge,sizeof(huge)));
+	const char short_str[] = {5,'a','b'};
+	check_malformed<binproto::variable_len_string<1> >(bytes_of(short_str,sizeof(short_str)));
+	check_malformed<binproto::variable_len_string_view<1> >(bytes_of(short_str,sizeof(short_str)));
+	check_malformed<binproto::fixed_len_string<8> >(bytes_of("abc",3));
+}
+
+static void check_validate()
+{
+	Student student;
+	student.name = "Han Meimei";
+	student.age = 13;
+	student.sex = "female";
+	std::vector<char> wire = check_roundtrip(student);
+	check_truncated<Student>(wire);
+	//bytes after the packet are left alone
+	wire.push_back(0x7f);
+	CHECK(Student::validate_buffer(&wire[0],wire.size()) == wire.size() - 1);
+
+	binproto::binary_obj_list<Student,2> list;
+	list.push_back(student);
+	student.name = "Jim";
+	list.push_back(student);
+	check_truncated<binproto::binary_obj_list<Student,2> >(check_roundtrip(list));
+}
+
+static void check_parse_status()
+{
+	//a count of 2^31 elements in a 4 byte buffer is rejected before the list is sized
+	const char count_only[] = {0x7f,(char)0xff,(char)0xff,(char)0xff};
+	std::vector<char> wire = bytes_of(count_only,sizeof(count_only));
+	check_malformed<binproto::binary_obj_list<Student,4> >(wire);
+	check_malformed<binproto::binary_obj_list<binproto::uint32_obj,4> >(wire);
+	check_malformed<binproto::binary_obj_list<binproto::variable_len_string<1>,4> >(wire);
+	//an 8 byte count of 2^32 + 1 must not be cut to 1
+	const char wide_count[] = {0,0,0,1,0,0,0,1,0,0};
+	wire = bytes_of(wide_count,sizeof(wide_count));
+	check_malformed<binproto::binary_obj_list<binproto::variable_len_string<1>,8> >(wire);
+	check_malformed<binproto::binary_obj_list<binproto::uint8_obj,8> >(wire);
+	check_stream_malformed<binproto::binary_obj_list<binproto::variable_len_string<1>,8> >(wire);
+
+	//the error offset points at the failing element
+	binproto::binary_obj_list<binproto::variable_len_string<1>,1> list;
+	list.push_back(binproto::variable_len_string<1>("ab"));
+	list.push_back(binproto::variable_len_string<1>("cd"));
+	wire = check_roundtrip(list);
+	wire[4] = 9;
+	binproto::parse_status status;
+	CHECK(list.parse_from_buffer(&wire[0],wire.size(),status) == 0);
+	CHECK(status.code() == binproto::parse_status::short_buffer && status.offset() == 4);
+}
+
+static Student make_student(const char* name,int age)
+{
+	Student student;
+	student.name = name;
+	student.age = age;
+	student.sex = "male";
+	return student;
+}
+
+static void check_sinks()
+{
+	binproto::binary_obj_list<Student,2> list;
+	for(int i = 0; i < 100; i++)
+		list.push_back(make_student("a student with a long enough name",i));
+	std::vector<char> wire = check_roundtrip(list);
+
+	std::vector<char> out(wire.size());
+	binproto::fixed_buffer_sink exact(&out[0],out.size());
+	CHECK(list.serialize_to_sink(exact) == wire.size());
+	CHECK(!exact.overflow() && exact.size() == wire.size() && out == wire);
+
+	//one byte short overflows, and writes nothing past the buffer
+	std::vector<char> small(wire.size(),'x');
+	binproto::fixed_buffer_sink short_sink(&small[0],small.size() - 1);
+	list.serialize_to_sink(short_sink);
+	CHECK(short_sink.overflow() && short_sink.size() < wire.size() && small.back() == 'x');
+
+	binproto::growable_buffer_sink grow(1);
+	list.serialize_to_sink(grow);
+	std::vector<char> moved;
+	grow.swap_buffer(moved);
+	CHECK(moved == wire && grow.size() == 0);
+
+#if !defined(_WIN32) && !defined(WIN32)
+	int fds[2];
+	if(pipe(fds) == 0)
+	{
+		{
+			binproto::fd_sink sink(fds[1],64);
+			make_student("piped",1).serialize_to_sink(sink);
+			CHECK(sink.flush() && !sink.failed());
+		}
+		std::vector<char> expect;
+		make_student("piped",1).serialize_to_buffer(expect);
+		std::vector<char> got(expect.size() + 1);
+		CHECK(read(fds[0],&got[0],got.size()) == (ssize_t)expect.size());
+		got.resize(expect.size());
+		CHECK(got == expect);
+		close(fds[0]);
+		close(fds[1]);
+	}
+#endif
+}
+
+static void check_std_string()
+{
+	Student first = make_student("first",1);
+	Student second = make_student("second",2);
+	std::vector<char> expect;
+	first.append_to_buffer(expect);
+	second.append_to_buffer(expect);
+
+	std::string str = "old content";
+	CHECK(first.serialize_to_buffer(str) == first.get_binary_len());
+	CHECK(second.append_to_buffer(str) == second.get_binary_len());
+	CHECK(str == std::string(expect.begin(),expect.end()));
+
+	Student parsed;
+	CHECK(parsed.parse_from_buffer(str.substr(first.get_binary_len())) == second.get_binary_len());
+	CHECK(parsed.name.to_string() == "second");
+	binproto::parse_status status;
+	CHECK(parsed.parse_from_buffer(str.substr(0,3),status) == 0 && !status.ok());
+}
+
+#if !defined(_WIN32) && !defined(WIN32)
+static void check_iovec_sink()
+{
+	binproto::binary_obj_list<binproto::variable_len_string<2>,1> list;
+	list.push_back(binproto::variable_len_string<2>("short"));
+	list.push_back(binproto::variable_len_string<2>(std::string(3000,'r')));
+	list.push_back(binproto::variable_len_string<2>("tail"));
+	std::vector<char> wire = check_roundtrip(list);
+
+	//the long string becomes a segment of its own, pointing at the list's storage
+	binproto::iovec_sink sink(1024);
+	CHECK(list.serialize_to_sink(sink) == wire.size() && sink.size() == wire.size());
+	CHECK(sink.iovec_count() == 3);
+	const struct iovec* iov = sink.iovecs();
+	std::vector<char> gathered;
+	for(int i = 0; i < sink.iovec_count(); i++)
+		gathered.insert(gathered.end(),(const char*)iov[i].iov_base,(const char*)iov[i].iov_base + iov[i].iov_len);
+	CHECK(gathered == wire);
+	sink.clear();
+	CHECK(sink.size() == 0 && sink.iovec_count() == 0);
+}
+#endif
+
+BINPROTO_DEFINE_PACKET_P02(Scores
+	,binproto::varint32_obj,id
+	,binproto::binary_obj_list<binproto::uint32_obj BINPROTO_COMMA 4>,scores);
+
+static void check_stream_decoder()
+{
+	std::vector<char> stream;
+	for(int i = 0; i < 20; i++)
+	{
+		Scores scores;
+		scores.id = i * 1000;
+		for(int k = 0; k < i; k++)
+			scores.scores.push_back(binproto::uint32_obj(k));
+		scores.append_to_buffer(stream);
+	}
+	//chunks of 1, 2, 4 ... bytes cut packets anywhere
+	for(uint32_t chunk = 1; chunk <= 64; chunk *= 2)
+	{
+		binproto::stream_decoder<Scores> decoder;
+		uint32_t pos = 0;
+		int decoded = 0;
+		while(pos < stream.size())
+		{
+			uint32_t n = stream.size() - pos < chunk ? stream.size() - pos : chunk;
+			uint32_t consumed = 0;
+			binproto::stream_decoder<Scores>::result result = decoder.feed(&stream[pos],n,consumed);
+			pos += consumed;
+			if(result == binproto::stream_decoder<Scores>::complete)
+			{
+				CHECK(decoder.packet().id.to_int() == (uint32_t)decoded * 1000);
+				CHECK(decoder.packet().scores.size() == (uint32_t)decoded);
+				++decoded;
+			}
+			else if(result != binproto::stream_decoder<Scores>::need_more || consumed != n)
+			{
+				CHECK(false);
+				break;
+			}
+		}
+		CHECK(decoded == 20 && !decoder.error());
+	}
+
+	//a count of 2^31 scores allocates only for the scores which arrived
+	const char huge_count[] = {1,0x7f,(char)0xff,(char)0xff,(char)0xff,0,0,0,1,0,0,0,2};
+	binproto::stream_decoder<Scores> decoder;
+	uint32_t consumed = 0;
+	CHECK(decoder.feed(huge_count,sizeof(huge_count),consumed) == binproto::stream_decoder<Scores>::need_more);
+	CHECK(consumed == sizeof(huge_count) && decoder.packet().scores.size() < 8);
+
+	//a varint of more than 5 bytes does not fit uint32_t, the stream can not be resynchronized
+	const char long_varint[] = {(char)0x80,(char)0x80,(char)0x80,(char)0x80,(char)0x80,0x01};
+	decoder.reset();
+	CHECK(decoder.feed(long_varint,sizeof(long_varint),consumed) == binproto::stream_decoder<Scores>::malformed);
+	CHECK(decoder.error() && decoder.feed(long_varint,1,consumed) == binproto::stream_decoder<Scores>::malformed && consumed == 0);
+	decoder.reset();
+	CHECK(!decoder.error());
+	check_stream_malformed<binproto::varint32_obj>(bytes_of(long_varint,sizeof(long_varint)));
+	check_malformed<binproto::varint32_obj>(bytes_of(long_varint,sizeof(long_varint)));
+
+	//an 8 byte length of 2^32 is malformed, rather than cut to 0 and waited on forever
+	const char wide_len[] = {0,0,0,1,0,0,0,0,'a','b'};
+	binproto::stream_decoder<binproto::variable_len_string<8> > str_decoder;
+	CHECK(str_decoder.feed(wide_len,sizeof(wide_len),consumed) == binproto::stream_decoder<binproto::variable_len_string<8> >::malformed);
+	check_stream_malformed<binproto::variable_len_string<8> >(bytes_of(wide_len,sizeof(wide_len)));
+	check_stream_malformed<binproto::compressed_blob<8> >(bytes_of(wide_len,sizeof(wide_len)));
+	check_malformed<binproto::variable_len_string<8> >(bytes_of(wide_len,sizeof(wide_len)));
+	check_malformed<binproto::compressed_blob<8> >(bytes_of(wide_len,sizeof(wide_len)));
+}
+
+static void check_frames()
+{
+	typedef binproto::frame_format<2,1> format;
+	std::vector<char> stream;
+	for(int i = 0; i < 30; i++)
+	{
+		Student student = make_student("Li Ming",i);
+		char buffer[64];
+		uint32_t n = format::serialize_frame(student,i % 3,buffer,sizeof(buffer));
+		stream.insert(stream.end(),buffer,buffer + n);
+	}
+	//a 64 byte ring makes frames wrap around its end
+	binproto::ring_frame_decoder<format> decoder(64);
+	uint32_t pos = 0;
+	int decoded = 0;
+	while(pos < stream.size())
+	{
+		uint32_t chunk = stream.size() - pos < 7 ? stream.size() - pos : 7;
+		pos += decoder.write(&stream[pos],chunk);
+		binproto::frame_view frame;
+		while(decoder.next_frame(frame))
+		{
+			Student student;
+			binproto::parse_status status;
+			CHECK(student.parse_from_buffer(frame.data,frame.size,status) == frame.size);
+			CHECK(frame.type_id == (uint32_t)decoded % 3 && student.age.to_int() == (uint32_t)decoded);
+			++decoded;
+		}
+	}
+	CHECK(decoded == 30 && decoder.size() == 0 && !decoder.error());
+
+	//a body larger than the ring
+	const char oversize[] = {0x01,0x00,0x00};
+	decoder.clear();
+	decoder.write(oversize,sizeof(oversize));
+	binproto::frame_view frame;
+	CHECK(!decoder.next_frame(frame) && decoder.error());
+
+	//an 8 byte length of 2^32 + 5 must not be truncated to 5
+	typedef binproto::frame_format<8> wide_format;
+	const char wide[] = {0,0,0,1,0,0,0,5,'a','b','c','d','e'};
+	uint32_t body_len = 0;
+	uint32_t type_id = 0;
+	CHECK(wide_format::parse_header(wide,sizeof(wide),body_len,type_id) == 0);
+	binproto::ring_frame_decoder<wide_format> wide_decoder(64);
+	wide_decoder.write(wide,sizeof(wide));
+	CHECK(!wide_decoder.next_frame(frame) && wide_decoder.error());
+}
+
+struct test_protocol
+{
+};
+BINPROTO_DEFINE_MESSAGE_ID(test_protocol,1,Student)
+BINPROTO_DEFINE_MESSAGE_ID(test_protocol,3,Scores)
+
+struct test_handler
+{
+	int students;
+	int scores;
+	uint32_t last_age;
+	test_handler()
+		:students(0),scores(0),last_age(0)
+	{
+	}
+	void on_message(const Student& student)
+	{
+		++students;
+		last_age = student.age.to_int();
+	}
+	void on_message(const Scores&)
+	{
+		++scores;
+	}
+};
+
+static void check_dispatcher()
+{
+	test_handler handler;
+	binproto::message_dispatcher<test_protocol,test_handler,4> dispatcher(handler);
+	std::vector<char> wire;
+	make_student("Li Ming",13).serialize_to_buffer(wire);
+	binproto::parse_status status;
+	CHECK(dispatcher.dispatch(1,&wire[0],wire.size(),status) == wire.size() && status.ok());
+	CHECK(handler.students == 1 && handler.last_age == 13);
+	CHECK(dispatcher.packet<1>().name == binproto::variable_len_string<1>("Li Ming"));
+
+	//unknown ids, inside and past the table
+	binproto::parse_status unknown;
+	CHECK(dispatcher.dispatch(2,&wire[0],wire.size(),unknown) == 0 && unknown.code() == binproto::parse_status::invalid_data);
+	binproto::parse_status past;
+	CHECK(dispatcher.dispatch(5,&wire[0],wire.size(),past) == 0 && past.code() == binproto::parse_status::invalid_data);
+
+	//a malformed body fails the status and does not reach the handler
+	binproto::parse_status truncated;
+	CHECK(dispatcher.dispatch(1,&wire[0],3,truncated) == 0 && !truncated.ok());
+	CHECK(handler.students == 1 && handler.scores == 0);
+
+	//messages after a bad one on the same status still reach the handler
+	CHECK(dispatcher.dispatch(2,&wire[0],wire.size(),status) == 0 && !status.ok());
+	CHECK(dispatcher.dispatch(1,&wire[0],wire.size(),status) == wire.size() && status.ok());
+	CHECK(dispatcher.dispatch(1,&wire[0],wire.size(),status) == wire.size() && status.ok());
+	CHECK(handler.students == 3);
+}
+
+typedef binproto::variable_len_string<2,binproto::arena_allocator<char> > arena_string;
+typedef binproto::binary_obj_list<arena_string,2,binproto::arena_allocator<arena_string> > arena_string_list;
+
+static void check_arena()
+{
+	binproto::monotonic_arena arena(1024);
+	char* first = (char*)arena.allocate(10);
+	char* large = (char*)arena.allocate(100000);
+	CHECK(((size_t)first & 15) == 0 && ((size_t)large & 15) == 0 && large != first);
+	//reset keeps the blocks, the next round starts from the first one again
+	arena.reset();
+	CHECK(arena.allocate(10) == first);
+	arena.reset();
+
+	std::vector<char> wire;
+	{
+		arena_string_list list;
+		list.push_back(arena_string("no arena"));
+		list.push_back(arena_string(std::string(300,'x')));
+		CHECK(list.begin()->to_string().get_allocator().arena() == NULL);
+		wire = check_roundtrip(list);
+	}
+	{
+		binproto::arena_scope scope(arena);
+		arena_string_list list;
+		binproto::parse_status status;
+		CHECK(list.parse_from_buffer(&wire[0],wire.size(),status) == wire.size());
+		CHECK(list.size() == 2 && list[1].size() == 300);
+		CHECK(list[1].to_string().get_allocator().arena() == &arena);
+		std::vector<char> again;
+		list.serialize_to_buffer(again);
+		CHECK(again == wire);
+	}
+	CHECK(binproto::arena_scope::current() == NULL);
+	arena.reset();
+
+	wire.resize(wire.size() - 1);
+	binproto::arena_scope scope(arena);
+	check_truncated<arena_string_list>(wire);
+}
+
+template<typename obj_type>
+static std::vector<char> serialized(const obj_type& obj)
+{
+	std::vector<char> wire;
+	obj.serialize_to_buffer(wire);
+	return wire;
+}
+
+static void check_list_reuse()
+{
+	typedef binproto::binary_obj_list<binproto::variable_len_string<2>,2> string_list;
+	string_list source;
+	source.push_back(binproto::variable_len_string<2>(std::string(100,'a')));
+	source.push_back(binproto::variable_len_string<2>(std::string(200,'b')));
+	std::vector<char> wire = check_roundtrip(source);
+
+	string_list list;
+	binproto::parse_status status;
+	CHECK(list.parse_from_buffer(&wire[0],wire.size(),status) == wire.size());
+	const char* first = list[0].c_str();
+	const char* second = list[1].c_str();
+
+	//the same shape with shorter strings parses into the same string buffers
+	string_list shorter;
+	shorter.push_back(binproto::variable_len_string<2>("x"));
+	shorter.push_back(binproto::variable_len_string<2>(std::string(150,'y')));
+	std::vector<char> shorter_wire = check_roundtrip(shorter);
+	CHECK(list.parse_from_buffer(&shorter_wire[0],shorter_wire.size(),status) == shorter_wire.size());
+	CHECK(serialized(list) == shorter_wire && list[0].c_str() == first && list[1].c_str() == second);
+
+	//fewer elements, then the same count again
+	string_list one;
+	one.push_back(binproto::variable_len_string<2>("z"));
+	std::vector<char> one_wire = check_roundtrip(one);
+	CHECK(list.parse_from_buffer(&one_wire[0],one_wire.size(),status) == one_wire.size());
+	CHECK(serialized(list) == one_wire && list[0].c_str() == first);
+	CHECK(list.parse_from_buffer(&wire[0],wire.size(),status) == wire.size() && serialized(list) == wire);
+
+	//a failed parse leaves a list that parses the next message correctly, with the same status
+	CHECK(list.parse_from_buffer(&wire[0],wire.size() - 1,status) == 0 && !status.ok());
+	CHECK(list.parse_from_buffer(&shorter_wire[0],shorter_wire.size(),status) == shorter_wire.size() && status.ok());
+	CHECK(serialized(list) == shorter_wire);
+	check_truncated<string_list>(wire);
+}
+
+//distinct bytes in every position of a 64 bit value
+static uint64_t num_pattern(uint32_t i)
+{
+	uint64_t low = i * 0x01020304u + 7;
+	return (low << 32) | (low ^ 0xa5a5a5a5u);
+}
+
+template<typename numtype>
+static void check_num_list(uint32_t count)
+{
+	binproto::binary_obj_list<binproto::num_obj<numtype>,4> list;
+	for(uint32_t i = 0; i < count; i++)
+		list.push_back(binproto::num_obj<numtype>((numtype)num_pattern(i)));
+	std::vector<char> wire = check_roundtrip(list);
+	CHECK(wire.size() == 4 + count * sizeof(numtype));
+	//every element is stored most significant byte first
+	for(uint32_t i = 0; i < count; i++)
+	{
+		uint64_t value = 0;
+		for(uint32_t k = 0; k < sizeof(numtype); k++)
+			value = (value << 8) | (unsigned char)wire[4 + i * sizeof(numtype) + k];
+		CHECK(value == (numtype)num_pattern(i));
+	}
+	if(count > 0)
+		check_malformed<binproto::binary_obj_list<binproto::num_obj<numtype>,4> >(std::vector<char>(wire.begin(),wire.end() - 1));
+}
+
+static void check_num_lists()
+{
+	//counts around the vector widths exercise the bulk loop and the scalar tail
+	const uint32_t counts[] = {0,1,3,4,7,8,15,16,17,33,1000};
+	for(size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+	{
+		check_num_list<uint16_t>(counts[i]);
+		check_num_list<uint32_t>(counts[i]);
+		check_num_list<uint64_t>(counts[i]);
+	}
+}
+
+BINPROTO_DEFINE_PACKET_P03(Tick
+	,binproto::uint32_obj,seq
+	,binproto::uint16_obj,price
+	,binproto::fixed_len_string<4>,symbol);
+
+static void check_static_packet()
+{
+	//the length is a compile time constant
+	char buffer[Tick::STATIC_BINARY_LENGTH];
+	CHECK(sizeof(buffer) == 10);
+	Tick tick;
+	tick.seq = 0x01020304;
+	tick.price = 0x0506;
+	tick.symbol = "ABCD";
+	CHECK(tick.serialize_to_buffer(buffer,sizeof(buffer)) == 10);
+	CHECK(memcmp(buffer,"\x01\x02\x03\x04\x05\x06" "ABCD",10) == 0);
+	std::vector<char> wire = check_roundtrip(tick);
+	check_truncated<Tick>(wire);
+
+	//a short buffer takes the field by field path, which reports the failing field
+	Tick parsed;
+	binproto::parse_status status;
+	CHECK(parsed.parse_from_buffer(buffer,5,status) == 0);
+	CHECK(status.code() == binproto::parse_status::short_buffer && status.offset() == 4);
+
+	binproto::binary_obj_list<Tick,2> ticks;
+	for(int i = 0; i < 9; i++)
+	{
+		tick.seq = i;
+		ticks.push_back(tick);
+	}
+	wire = check_roundtrip(ticks);
+	CHECK(wire.size() == 2 + 9 * 10);
+	check_malformed<binproto::binary_obj_list<Tick,2> >(std::vector<char>(wire.begin(),wire.end() - 1));
+}
+
+static void check_byte_order()
+{
+	const char expected[] = {0x01,0x23,0x45,0x67,(char)0x89,(char)0xab,(char)0xcd,(char)0xef};
+	uint64_t value = ((uint64_t)0x01234567 << 32) | 0x89abcdef;
+	//an odd offset checks unaligned loads and stores
+	char buffer[9];
+	binproto::uint64_obj num(value);
+	CHECK(num.serialize_to_buffer(buffer + 1,8) == 8 && memcmp(buffer + 1,expected,8) == 0);
+	std::vector<char> wire = check_roundtrip(num);
+	CHECK(memcmp(&wire[0],expected,8) == 0);
+	binproto::uint64_obj parsed;
+	binproto::parse_status status;
+	CHECK(parsed.parse_from_buffer(buffer + 1,8,status) == 8 && parsed.to_int() == value);
+	check_truncated<binproto::uint64_obj>(wire);
+
+	CHECK(binproto::uint32_obj(0x01234567).serialize_to_buffer(buffer + 1,4) == 4 && memcmp(buffer + 1,expected,4) == 0);
+	CHECK(binproto::uint16_obj(0x0123).serialize_to_buffer(buffer + 1,2) == 2 && memcmp(buffer + 1,expected,2) == 0);
+	check_truncated<binproto::uint32_obj>(check_roundtrip(binproto::uint32_obj(0x01234567)));
+	check_truncated<binproto::uint16_obj>(check_roundtrip(binproto::uint16_obj(0x0123)));
+}
+
+BINPROTO_DEFINE_PACKET_P02(LeHeader
+	,binproto::uint16_le_obj,kind
+	,binproto::uint64_le_obj,stamp);
+
+static void check_little_endian()
+{
+	const char expected[] = {(char)0xef,(char)0xcd,(char)0xab,(char)0x89,0x67,0x45,0x23,0x01};
+	uint64_t value = ((uint64_t)0x01234567 << 32) | 0x89abcdef;
+	std::vector<char> wire = check_roundtrip(binproto::uint64_le_obj(value));
+	CHECK(wire.size() == 8 && memcmp(&wire[0],expected,8) == 0);
+	wire = check_roundtrip(binproto::uint32_le_obj(0x89abcdef));
+	CHECK(wire.size() == 4 && memcmp(&wire[0],expected,4) == 0);
+	wire = check_roundtrip(binproto::uint16_le_obj(0xcdef));
+	CHECK(wire.size() == 2 && memcmp(&wire[0],expected,2) == 0);
+	check_truncated<binproto::uint16_le_obj>(wire);
+
+	LeHeader header;
+	header.kind = 0xcdef;
+	header.stamp = value;
+	wire = check_roundtrip(header);
+	CHECK(wire.size() == 10 && memcmp(&wire[0],expected,2) == 0 && memcmp(&wire[2],expected,8) == 0);
+	check_truncated<LeHeader>(wire);
+
+	//the list length prefix keeps the default order, the elements are little endian
+	binproto::binary_obj_list<binproto::uint32_le_obj,2> list;
+	for(int i = 0; i < 19; i++)
+		list.push_back(binproto::uint32_le_obj(0x89abcdef));
+	wire = check_roundtrip(list);
+	CHECK(wire.size() == 2 + 19 * 4 && wire[1] == 19 && memcmp(&wire[2 + 18 * 4],expected,4) == 0);
+}
+
+template<typename obj_type>
+static void check_encoding(const obj_type& obj,const char* expected,uint32_t len)
+{
+	std::vector<char> wire = check_roundtrip(obj);
+	CHECK(obj.get_binary_len() == len && wire.size() == len && memcmp(&wire[0],expected,len) == 0);
+	check_truncated<obj_type>(wire);
+}
+
+template<typename list_type, typename obj_type>
+static void check_varint_list(const obj_type* values,uint32_t n)
+{
+	list_type list;
+	for(uint32_t i = 0; i < n; i++)
+		list.push_back(values[i]);
+	std::vector<char> wire = check_roundtrip(list);
+	if(n > 0)
+		check_truncated<list_type>(wire);
+}
+
+static void check_varints()
+{
+	check_encoding(binproto::varint32_obj(0),"\x00",1);
+	check_encoding(binproto::varint32_obj(127),"\x7f",1);
+	check_encoding(binproto::varint32_obj(300),"\xac\x02",2);
+	check_encoding(binproto::varint32_obj(UINT32_MAX),"\xff\xff\xff\xff\x0f",5);
+	check_encoding(binproto::varint16_obj(UINT16_MAX),"\xff\xff\x03",3);
+	check_encoding(binproto::varint64_obj(UINT64_MAX),"\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01",10);
+	check_encoding(binproto::zigzag32_obj(0),"\x00",1);
+	check_encoding(binproto::zigzag32_obj(-1),"\x01",1);
+	check_encoding(binproto::zigzag32_obj(1),"\x02",1);
+	check_encoding(binproto::zigzag32_obj(INT32_MIN),"\xff\xff\xff\xff\x0f",5);
+	check_encoding(binproto::zigzag16_obj(INT16_MIN),"\xff\xff\x03",3);
+	check_encoding(binproto::zigzag64_obj(INT64_MAX),"\xfe\xff\xff\xff\xff\xff\xff\xff\xff\x01",10);
+
+	//values past the wire type and varints longer than it
+	check_malformed<binproto::varint16_obj>(bytes_of("\xff\xff\x04",3));
+	check_malformed<binproto::varint16_obj>(bytes_of("\x80\x80\x80\x00",4));
+	check_malformed<binproto::varint32_obj>(bytes_of("\xff\xff\xff\xff\x10",5));
+	check_malformed<binproto::zigzag32_obj>(bytes_of("\xff\xff\xff\xff\x10",5));
+	check_stream_malformed<binproto::varint16_obj>(bytes_of("\xff\xff\x04",3));
+	check_stream_malformed<binproto::zigzag64_obj>(bytes_of("\xff\xff\xff\xff\xff\xff\xff\xff\xff\x02",10));
+
+	//mixed lengths, runs of one byte values and lists long enough for the word at a time path
+	uint32_t values[64];
+	binproto::zigzag64_obj signed_values[64];
+	for(uint32_t i = 0; i < 64; i++)
+	{
+		values[i] = (i % 9 == 0) ? (UINT32_MAX >> (i % 32)) : i;
+		signed_values[i] = (int64_t)values[i] * ((i & 1) ? -1 : 1) * (int64_t)(i + 1);
+	}
+	for(uint32_t n = 0; n <= 64; n += 7)
+	{
+		binproto::varint32_obj objs[64];
+		for(uint32_t i = 0; i < n; i++)
+			objs[i] = values[i];
+		check_varint_list<binproto::binary_obj_list<binproto::varint32_obj,2> >(objs,n);
+		check_varint_list<binproto::binary_obj_list<binproto::zigzag64_obj,2> >(signed_values,n);
+	}
+
+	//an overflowing element inside a run, with more than 8 bytes after it
+	const char bad_run[] = {0,12,1,2,(char)0xff,(char)0xff,0x04,1,2,3,4,5,6,7,8,9};
+	check_malformed<binproto::binary_obj_list<binproto::varint16_obj,2> >(bytes_of(bad_run,sizeof(bad_run)));
+	check_stream_malformed<binproto::binary_obj_list<binproto::varint16_obj,2> >(bytes_of(bad_run,sizeof(bad_run)));
+	const char long_run[] = {0,12,1,(char)0x80,(char)0x80,(char)0x80,(char)0x80,(char)0x80,0x01,1,2,3,4,5,6,7,8,9,10,11};
+	check_malformed<binproto::binary_obj_list<binproto::varint32_obj,2> >(bytes_of(long_run,sizeof(long_run)));
+}
+
+template<typename be_type, typename le_type>
+static void check_signed_pair(const be_type& be,const le_type& le,const char* expected,uint32_t len)
+{
+	check_encoding(be,expected,len);
+	char reversed[8];
+	for(uint32_t i = 0; i < len; i++)
+		reversed[i] = expected[len - 1 - i];
+	check_encoding(le,reversed,len);
+}
+
+static void check_signed_and_float()
+{
+	check_encoding(binproto::int8_obj(-2),"\xfe",1);
+	check_signed_pair(binproto::int16_be_obj(-2),binproto::int16_le_obj(-2),"\xff\xfe",2);
+	check_signed_pair(binproto::int32_be_obj(INT32_MIN),binproto::int32_le_obj(INT32_MIN),"\x80\x00\x00\x00",4);
+	check_signed_pair(binproto::int64_be_obj(-3),binproto::int64_le_obj(-3),"\xff\xff\xff\xff\xff\xff\xff\xfd",8);
+	check_signed_pair(binproto::float32_be_obj(1.0f),binproto::float32_le_obj(1.0f),"\x3f\x80\x00\x00",4);
+	check_signed_pair(binproto::float64_be_obj(-2.0),binproto::float64_le_obj(-2.0),"\xc0\x00\x00\x00\x00\x00\x00\x00",8);
+	//the default order is big endian
+	check_encoding(binproto::float64_obj(-2.0),"\xc0\x00\x00\x00\x00\x00\x00\x00",8);
+	check_encoding(binproto::int32_obj(-1),"\xff\xff\xff\xff",4);
+
+	//lists of doubles go through the bulk conversion
+	binproto::binary_obj_list<binproto::float64_obj,4> doubles;
+	binproto::binary_obj_list<binproto::float64_le_obj,4> le_doubles;
+	for(int i = 0; i < 37; i++)
+	{
+		doubles.push_back(binproto::float64_obj(i * -0.5));
+		le_doubles.push_back(binproto::float64_le_obj(i * -0.5));
+	}
+	std::vector<char> wire = check_roundtrip(doubles);
+	CHECK(memcmp(&wire[4 + 4 * 8],"\xc0\x00\x00\x00\x00\x00\x00\x00",8) == 0);
+	binproto::binary_obj_list<binproto::float64_obj,4> parsed;
+	binproto::parse_status status;
+	CHECK(parsed.parse_from_buffer(&wire[0],wire.size(),status) == wire.size() && parsed[36].to_int() == -18.0);
+	wire = check_roundtrip(le_doubles);
+	CHECK(memcmp(&wire[4 + 4 * 8],"\x00\x00\x00\x00\x00\x00\x00\xc0",8) == 0);
+	check_malformed<binproto::binary_obj_list<binproto::float64_le_obj,4> >(std::vector<char>(wire.begin(),wire.end() - 1));
+	binproto::binary_obj_list<binproto::int16_be_obj,4> shorts;
+	for(int i = 0; i < 21; i++)
+		shorts.push_back(binproto::int16_be_obj(-i));
+	check_roundtrip(shorts);
+}
+
+typedef binproto::bit_field_group<1,3,12> flags_group;
+BINPROTO_DEFINE_PACKET_P02(Flagged
+	,flags_group,flags
+	,binproto::uint8_obj,kind);
+
+static void check_bit_fields()
+{
+	flags_group flags;
+	flags.set<0>(1);
+	flags.set<1>(5);
+	flags.set<2>(0xabc);
+	CHECK(flags_group::STATIC_BINARY_LENGTH == 2);
+	//1, 101 and 1010 1011 1100 fill the 16 bits exactly
+	check_encoding(flags,"\xda\xbc",2);
+	CHECK(flags.get<0>() == 1 && flags.get<1>() == 5 && flags.get<2>() == 0xabc);
+	CHECK(flags.get(1) == 5 && flags.get(2) == 0xabc);
+	flags.set(1,2);
+	CHECK(flags.get<0>() == 1 && flags.get<1>() == 2 && flags.get<2>() == 0xabc);
+
+	//unused low bits are zero
+	binproto::bit_field_group<1,2> small;
+	small.set<0>(1);
+	small.set<1>(3);
+	check_encoding(small,"\xe0",1);
+	binproto::bit_field_group<4,4> ip;
+	ip.set<0>(4);
+	ip.set<1>(5);
+	check_encoding(ip,"\x45",1);
+	binproto::bit_field_group<1,63> wide;
+	wide.set<0>(1);
+	wide.set<1>(1);
+	check_encoding(wide,"\x80\x00\x00\x00\x00\x00\x00\x01",8);
+	CHECK(wide.get<0>() == 1 && wide.get<1>() == 1);
+
+	//a packet of bit fields keeps the static fast path
+	CHECK(Flagged::STATIC_BINARY_LENGTH == 3);
+	Flagged packet;
+	packet.flags = flags;
+	packet.kind = 7;
+	check_truncated<Flagged>(check_roundtrip(packet));
+}
+
+BINPROTO_DEFINE_PACKET_P04(Update
+	,binproto::optional_obj<binproto::uint32_obj>,price
+	,binproto::uint8_obj,kind
+	,binproto::optional_obj<binproto::variable_len_string<1> >,note
+	,binproto::optional_obj<binproto::binary_obj_list<binproto::uint16_obj BINPROTO_COMMA 1> >,levels);
+
+static void check_optional()
+{
+	//absent fields take no bytes, the bitmap holds one bit per optional field from the top
+	Update update;
+	update.kind = 9;
+	check_encoding(update,"\x00\x09",2);
+	update.note = binproto::variable_len_string<1>("hi");
+	check_encoding(update,"\x40\x09\x02hi",5);
+	update.price = binproto::uint32_obj(0x01020304);
+	update.levels.emplace().push_back(binproto::uint16_obj(7));
+	std::vector<char> wire = check_roundtrip(update);
+	CHECK(wire.size() == 1 + 4 + 1 + 3 + 3 && (uint8_t)wire[0] == 0xe0);
+
+	Update parsed;
+	binproto::parse_status status;
+	CHECK(parsed.parse_from_buffer(&wire[0],wire.size(),status) == wire.size());
+	CHECK(parsed.price.has_value() && parsed.price.value().to_int() == 0x01020304);
+	CHECK(parsed.levels.has_value() && parsed.levels.value().size() == 1);
+	//parsing a message without the fields clears them
+	CHECK(parsed.parse_from_buffer("\x00\x05",2,status) == 2);
+	CHECK(!parsed.price.has_value() && !parsed.note.has_value() && !parsed.levels.has_value() && parsed.kind.to_int() == 5);
+
+	//outside a packet the presence is one byte 0 or 1
+	binproto::optional_obj<binproto::uint16_obj> single;
+	check_encoding(single,"\x00",1);
+	single = binproto::uint16_obj(0x0102);
+	check_encoding(single,"\x01\x01\x02",3);
+	check_malformed<binproto::optional_obj<binproto::uint16_obj> >(bytes_of("\x02\x01\x02",3));
+	check_stream_malformed<binproto::optional_obj<binproto::uint16_obj> >(bytes_of("\x02\x01\x02",3));
+
+	binproto::binary_obj_list<binproto::optional_obj<binproto::uint16_obj>,1> list;
+	for(int i = 0; i < 5; i++)
+		list.push_back(i % 2 ? binproto::optional_obj<binproto::uint16_obj>(binproto::uint16_obj(i)) : binproto::optional_obj<binproto::uint16_obj>());
+	wire = check_roundtrip(list);
+	check_truncated<binproto::binary_obj_list<binproto::optional_obj<binproto::uint16_obj>,1> >(wire);
+	wire[5] = 2;
+	check_malformed<binproto::binary_obj_list<binproto::optional_obj<binproto::uint16_obj>,1> >(wire);
+	check_stream_malformed<binproto::binary_obj_list<binproto::optional_obj<binproto::uint16_obj>,1> >(wire);
+}
+
+static std::string log_text(uint32_t lines)
+{
+	std::string text;
+	char line[128];
+	for(uint32_t i = 0; i < lines; i++)
+	{
+		sprintf(line,"2024-05-01 12:00:%02u INFO request id=%u path=/api/v1/items status=200\n",i % 60,i * 7919);
+		text += line;
+	}
+	return text;
+}
+
+static void check_compressed_blob()
+{
+	typedef binproto::compressed_blob<4> blob;
+	std::string text = log_text(200);
+	blob packed(text);
+	CHECK(packed.compressed());
+	std::vector<char> wire = check_roundtrip(packed);
+	CHECK(wire.size() < text.size() / 2 && wire[4] == blob::METHOD_LZ);
+	blob parsed;
+	binproto::parse_status status;
+	CHECK(parsed.parse_from_buffer(&wire[0],wire.size(),status) == wire.size() && parsed == packed);
+	check_truncated<blob>(std::vector<char>(wire.begin(),wire.begin() + 40));
+
+	//short blobs go raw
+	blob raw(std::string("short"));
+	CHECK(!raw.compressed());
+	check_encoding(raw,"\x00\x00\x00\x06\x00short",10);
+
+	//an unknown method, a decoded length past what the block can expand to, and a corrupt block
+	check_malformed<blob>(bytes_of("\x00\x00\x00\x02\x02x",6));
+	check_stream_malformed<blob>(bytes_of("\x00\x00\x00\x02\x02x",6));
+	check_malformed<blob>(bytes_of("\x00\x00\x00\x07\x01\x7f\xff\xff\xff\x00\x00",11));
+	std::vector<char> corrupt = wire;
+	for(size_t i = 9; i < corrupt.size(); i++)
+		corrupt[i] = (char)0xff;
+	//validate_buffer checks only the framing of a block, decoding checks the rest
+	CHECK(blob::validate_buffer(&corrupt[0],corrupt.size()) == corrupt.size());
+	CHECK(parsed.parse_from_buffer(&corrupt[0],corrupt.size(),status) == 0 && status.code() == binproto::parse_status::invalid_data);
+	CHECK(parsed.size() == 0);
+	check_stream_malformed<blob>(corrupt);
+
+	//a blob which was serialized and then parses other bytes must serialize what it parsed
+	binproto::parse_cursor cursor;
+	const char* cur = &wire[0];
+	uint32_t left = wire.size();
+	std::vector<char> raw_wire = check_roundtrip(raw);
+	CHECK(packed.parse_some(cur,left,cursor,0));
+	cur = &raw_wire[0];
+	left = raw_wire.size();
+	cursor.clear();
+	CHECK(packed.parse_some(cur,left,cursor,0) && serialized(packed) == raw_wire);
+	cur = &corrupt[0];
+	left = corrupt.size();
+	cursor.clear();
+	CHECK(!packed.parse_some(cur,left,cursor,0) && cursor.failed());
+	CHECK(packed.size() == 0 && serialized(packed) == serialized(blob()));
+	//the rejected bytes do not stay behind as the encoded form
+	packed = text;
+	CHECK(serialized(packed) == wire);
+	const char bad_method[] = {0,0,0,2,2,'x'};
+	cur = bad_method;
+	left = sizeof(bad_method);
+	cursor.clear();
+	CHECK(!packed.parse_some(cur,left,cursor,0) && cursor.failed());
+	CHECK(packed.size() == 0 && serialized(packed) == serialized(blob()));
+}
+
+static void check_dict_list()
+{
+	typedef binproto::dict_obj_list<binproto::variable_len_string<1>,2> dict_list;
+	const char* const words[] = {"buy","sell","buy","hold","sell","buy"};
+	dict_list list;
+	for(int i = 0; i < 6; i++)
+		list.push_back(binproto::variable_len_string<1>(words[i]));
+	CHECK(list.dictionary().size() == 3 && list.code(2) == 0);
+	//dictionary of 3, then 6 one byte codes
+	check_encoding(list,"\x00\x03\x03" "buy\x04" "sell\x04" "hold\x00\x06\x00\x01\x00\x02\x01\x00",24);
+
+	//adding after a parse rebuilds the lookup
+	dict_list parsed;
+	std::vector<char> wire = serialized(list);
+	binproto::parse_status status;
+	CHECK(parsed.parse_from_buffer(&wire[0],wire.size(),status) == wire.size() && parsed == list);
+	parsed.push_back(binproto::variable_len_string<1>("hold"));
+	parsed.push_back(binproto::variable_len_string<1>("wait"));
+	CHECK(parsed.dictionary().size() == 4 && parsed.code(6) == 2 && parsed.code(7) == 3);
+
+	//257 distinct values take two byte codes
+	binproto::dict_obj_list<binproto::uint16_obj,4> wide;
+	for(int i = 0; i < 600; i++)
+		wide.push_back(binproto::uint16_obj(i % 257));
+	wire = check_roundtrip(wide);
+	CHECK(wire.size() == 4 + 257 * 2 + 4 + 600 * 2);
+
+	//a code past the dictionary
+	wire = serialized(list);
+	wire[wire.size() - 3] = 3;
+	check_malformed<dict_list>(wire);
+	check_stream_malformed<dict_list>(wire);
+	CHECK(parsed.parse_from_buffer(&wire[0],wire.size(),status) == 0 && status.code() == binproto::parse_status::invalid_data);
+	CHECK(parsed.size() == 0);
+	//a code count past the buffer is refused before the codes are sized
+	const char huge_count[] = {0,0,0x7f,(char)0xff,0};
+	check_malformed<dict_list>(bytes_of(huge_count,sizeof(huge_count)));
+	check_truncated<dict_list>(serialized(list));
+	//8 byte code counts of 2^63, whose two byte codes would wrap to 0 bytes, and of 2^32 + 1
+	typedef binproto::dict_obj_list<binproto::uint16_obj,8> wide_dict_list;
+	wide_dict_list wide_count;
+	for(int i = 0; i < 257; i++)
+		wide_count.push_back(binproto::uint16_obj(i));
+	wire = serialized(wide_count);
+	wire.resize(8 + 257 * 2);
+	const char count_2_63[] = {(char)0x80,0,0,0,0,0,0,0};
+	wire.insert(wire.end(),count_2_63,count_2_63 + 8);
+	check_malformed<wide_dict_list>(wire);
+	const char count_2_32[] = {0,0,0,1,0,0,0,1,0,0};
+	wire.resize(8 + 257 * 2);
+	wire.insert(wire.end(),count_2_32,count_2_32 + 10);
+	check_malformed<wide_dict_list>(wire);
+	check_stream_malformed<wide_dict_list>(wire);
+}
+
+template<typename int_type>
+static void check_delta_list(uint32_t count,int_type step)
+{
+	typedef binproto::delta_packed_list<int_type,4> delta_list;
+	delta_list list;
+	int_type value = (int_type)-1000;
+	for(uint32_t i = 0; i < count; i++)
+	{
+		//mostly steady steps with an occasional jump back
+		value = (int_type)(value + (i % 37 == 36 ? (int_type)(0 - 5 * step) : step));
+		list.push_back(value);
+	}
+	std::vector<char> wire = check_roundtrip(list);
+	delta_list parsed;
+	binproto::parse_status status;
+	CHECK(parsed.parse_from_buffer(&wire[0],wire.size(),status) == wire.size() && parsed == list);
+	if(count > 0)
+	{
+		CHECK(parsed[count - 1] == value && parsed[0] == list[0]);
+		check_malformed<delta_list>(std::vector<char>(wire.begin(),wire.end() - 1));
+	}
+	//values added after a parse continue the last block
+	parsed.push_back(value);
+	list.push_back(value);
+	CHECK(serialized(parsed) == serialized(list));
+}
+
+static void check_delta_lists()
+{
+	const uint32_t counts[] = {0,1,2,127,128,129,300};
+	for(size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+	{
+		check_delta_list<int32_t>(counts[i],3);
+		check_delta_list<int64_t>(counts[i],(int64_t)1 << 40);
+		check_delta_list<uint16_t>(counts[i],0);
+	}
+	//equal values pack to a zero width
+	binproto::delta_packed_list<int32_t,4> flat;
+	for(int i = 0; i < 200; i++)
+		flat.push_back(7);
+	CHECK(serialized(flat).size() == 4 + 5 + 5);
+	check_roundtrip(flat);
+
+	//a width larger than the type
+	const char wide[] = {0,0,0,2,0,0,0,1,33,0,0,0,0,0,0,0,0,0};
+	check_malformed<binproto::delta_packed_list<int32_t,4> >(bytes_of(wide,sizeof(wide)));
+	check_stream_malformed<binproto::delta_packed_list<int32_t,4> >(bytes_of(wide,sizeof(wide)));
+	//a count larger than the blocks which follow
+	const char huge_count[] = {0x7f,(char)0xff,(char)0xff,(char)0xff,0,0,0,1,0};
+	check_malformed<binproto::delta_packed_list<int32_t,4> >(bytes_of(huge_count,sizeof(huge_count)));
+	//an 8 byte count of 2^32 + 1 with the one block it would be cut to
+	const char wide_count[] = {0,0,0,1,0,0,0,1,0,0,0,7,0};
+	check_malformed<binproto::delta_packed_list<uint32_t,8> >(bytes_of(wide_count,sizeof(wide_count)));
+	check_stream_malformed<binproto::delta_packed_list<uint32_t,8> >(bytes_of(wide_count,sizeof(wide_count)));
+}
+
+BINPROTO_DEFINE_PACKET_P05(Row
+	,binproto::uint32_obj,id
+	,binproto::variable_len_string<1>,name
+	,binproto::fixed_len_string<4>,code
+	,binproto::optional_obj<binproto::uint16_obj>,level
+	,binproto::varint32_obj,count);
+
+static void check_columnar()
+{
+	typedef binproto::columnar_obj_list<Row,2> row_columns;
+	row_columns columns;
+	binproto::binary_obj_list<Row,2> rows;
+	for(uint32_t i = 0; i < 50; i++)
+	{
+		Row row;
+		row.id = i * 3;
+		row.name = std::string(i % 7,'n');
+		row.code = "AB";
+		if(i % 3 == 0)
+			row.level = binproto::uint16_obj(i);
+		row.count = i * 1000;
+		columns.push_back(row);
+		rows.push_back(row);
+	}
+	//same encoding as a list of the packets
+	std::vector<char> wire = check_roundtrip(columns);
+	CHECK(wire == serialized(rows));
+
+	row_columns parsed;
+	binproto::parse_status status;
+	CHECK(parsed.parse_from_buffer(&wire[0],wire.size(),status) == wire.size() && parsed.size() == 50);
+	CHECK(parsed.columns().id.data()[49] == 147 && parsed.columns().name.size(13) == 6);
+	CHECK(memcmp(parsed.columns().code.data(2),"AB\0\0",4) == 0);
+	CHECK(parsed.columns().level[3].has_value() && !parsed.columns().level[4].has_value());
+	Row row = parsed[48];
+	CHECK(row.id.to_int() == 144 && row.level.value().to_int() == 48 && row.count.to_int() == 48000);
+
+	//a failed parse leaves the list empty, also after a previous parse
+	std::vector<char> short_wire(wire.begin(),wire.end() - 1);
+	CHECK(parsed.parse_from_buffer(&short_wire[0],short_wire.size(),status) == 0 && parsed.size() == 0);
+	check_malformed<row_columns>(short_wire);
+	check_truncated<row_columns>(std::vector<char>(wire.begin(),wire.begin() + 30));
+#ifndef BINPROTO_NO_EXCEPTIONS
+	CHECK(parsed.parse_from_buffer(&wire[0],wire.size()) == wire.size());
+	bool thrown = false;
+	try
+	{
+		parsed.parse_from_buffer(&short_wire[0],short_wire.size());
+	}
+	catch(const binproto::exception&)
+	{
+		thrown = true;
+	}
+	CHECK(thrown && parsed.size() == 0 && parsed.columns().id.size() == 0 && parsed.columns().name.size() == 0);
+#endif
+	//a bogus row count only reserves what the buffer can hold
+	const char huge_count[] = {(char)0xff,(char)0xff,0,0,0,0};
+	check_malformed<row_columns>(bytes_of(huge_count,sizeof(huge_count)));
+}
+
+//claims a length of 2^31 bytes, so a few of them overflow a 32 bit total
+struct huge_packet
+{
+	uint32_t get_binary_len() const
+	{
+		return 0x80000000u;
+	}
+	uint32_t serialize_to_buffer(char*,uint32_t) const
+	{
+		++failures;
+		return 0;
+	}
+};
+
+template<typename pool_type>
+static void check_batch_on(pool_type& pool)
+{
+	std::vector<Student> students;
+	std::vector<char> serial;
+	//enough packets for several slices, with an uneven split
+	for(int i = 0; i < 3001; i++)
+	{
+		students.push_back(make_student(i % 5 ? "Li Ming" : "Han Meimei",i % 200));
+		students.back().append_to_buffer(serial);
+	}
+	std::vector<char> out(7,'x');
+	CHECK(binproto::serialize_batch(students.begin(),students.end(),out,pool) == serial.size() && out == serial);
+	std::vector<char> raw(serial.size(),'y');
+	CHECK(binproto::serialize_batch(students.begin(),students.end(),&raw[0],raw.size(),pool) == serial.size() && raw == serial);
+	//a short buffer is left untouched
+	std::vector<char> small(serial.size() - 1,'z');
+	CHECK(binproto::serialize_batch(students.begin(),students.end(),&small[0],small.size(),pool) == serial.size());
+	CHECK(small == std::vector<char>(serial.size() - 1,'z'));
+	std::vector<Student> none;
+	CHECK(binproto::serialize_batch(none.begin(),none.end(),out,pool) == 0 && out.empty());
+}
+
+static void check_batch()
+{
+	binproto::inline_pool pool;
+	check_batch_on(pool);
+#ifdef _BINPROTO_THREADS
+	binproto::thread_pool threads(3);
+	check_batch_on(threads);
+#endif
+#if defined(NDEBUG) || defined(BINPROTO_DISABLE_ASSERT)
+	//a total past uint32_t writes nothing, the assert catches it when asserts are on
+	std::vector<huge_packet> huge(3);
+	std::vector<char> out(5,'x');
+	CHECK(binproto::serialize_batch(huge.begin(),huge.end(),out,pool) == UINT32_MAX && out.empty());
+	char buffer[4];
+	CHECK(binproto::serialize_batch(huge.begin(),huge.end(),buffer,sizeof(buffer),pool) == UINT32_MAX);
+#endif
+}
+
+BINPROTO_DEFINE_PACKET_P00(Empty);
+
+static void check_empty_packet()
+{
+	//no bytes on the wire, validate_buffer has nothing to check and returns the length 0
+	Empty empty;
+	CHECK(empty.get_binary_len() == 0 && serialized(empty).empty());
+	CHECK(Empty::validate_buffer("x",1) == 0 && Empty::validate_buffer(NULL,0) == 0);
+	binproto::parse_status status;
+	CHECK(empty.parse_from_buffer("x",1,status) == 0 && status.ok());
+#ifndef BINPROTO_NO_EXCEPTIONS
+	CHECK(Empty::skip_from_buffer(NULL,0) == 0 && empty.parse_from_buffer(NULL,0) == 0);
+#endif
+	//rows without bytes do not bound the count, an 8 byte count past 32 bits is refused rather than looped on
+	const char wide_count[] = {0,0,0,1,0,0,0,1};
+	check_malformed<binproto::columnar_obj_list<Empty,8> >(bytes_of(wide_count,sizeof(wide_count)));
+	check_stream_malformed<binproto::columnar_obj_list<Empty,8> >(bytes_of(wide_count,sizeof(wide_count)));
+}
+
+//one status reused across a failed parse and a good one reports the good one
+static void check_status_reuse()
+{
+	binproto::parse_status status;
+	std::vector<char> wire = serialized(make_student("Li Ming",13));
+	Student student;
+	CHECK(student.parse_from_buffer(&wire[0],3,status) == 0 && !status.ok());
+	CHECK(student.parse_from_buffer(&wire[0],wire.size(),status) == wire.size() && status.ok());
+	CHECK(status.offset() == 0);
+
+	Tick tick;
+	tick.seq = 7;
+	wire = serialized(tick);
+	CHECK(tick.parse_from_buffer(&wire[0],wire.size() - 1,status) == 0 && !status.ok());
+	CHECK(tick.parse_from_buffer(&wire[0],wire.size(),status) == wire.size() && status.ok() && tick.seq.to_int() == 7);
+
+	binproto::uint32_obj num;
+	CHECK(num.parse_from_buffer("abc",3,status) == 0 && !status.ok());
+	CHECK(num.parse_from_buffer("abcd",4,status) == 4 && status.ok());
+}
+
+#ifndef BINPROTO_NO_EXCEPTIONS
+static void check_views()
+{
+	Student student;
+	student.name = "Li Ming";
+	student.age = 13;
+	student.sex = "male";
+	std::vector<char> wire = check_roundtrip(student);
+	Student::view view(&wire[0],wire.size());
+	CHECK(view.name().size() == 7 && memcmp(view.name().data(),"Li Ming",7) == 0);
+	CHECK(view.age().to_int() == 13);
+	CHECK(view.sex().trim() == "male");
+	CHECK(view.get_binary_len() == wire.size());
+
+	//the name length runs past the end, fields after it can not be located
+	Student::view bad(&wire[0],5);
+	bool thrown = false;
+	try
+	{
+		bad.age();
+	}
+	catch(const binproto::exception&)
+	{
+		thrown = true;
+	}
+	CHECK(thrown);
+}
+#endif
+
+int main()
+{
+	check_strings();
+	check_validate();
+	check_parse_status();
+	check_sinks();
+	check_std_string();
+	check_stream_decoder();
+#if !defined(_WIN32) && !defined(WIN32)
+	check_iovec_sink();
+#endif
+	check_status_reuse();
+	check_empty_packet();
+	check_batch();
+	check_columnar();
+	check_delta_lists();
+	check_dict_list();
+	check_compressed_blob();
+	check_optional();
+	check_bit_fields();
+	check_signed_and_float();
+	check_varints();
+	check_little_endian();
+	check_byte_order();
+	check_static_packet();
+	check_num_lists();
+	check_list_reuse();
+	check_arena();
+	check_dispatcher();
+	check_frames();
+#ifndef BINPROTO_NO_EXCEPTIONS
+	check_views();
+#endif
+	if(failures != 0)
+	{
+		printf("%d checks failed.\n",failures);
+		return 1;
+	}
+	printf("all checks passed.\n");
+	return 0;
+}